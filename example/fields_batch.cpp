@@ -0,0 +1,112 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <iostream>
+
+#include <cstdio>
+#include <vector>
+#include <chrono>
+#include <iterator>
+
+#include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/fp_batch.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+long long get_nsec_time() {
+    auto timepoint = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint.time_since_epoch()).count();
+}
+
+template<typename FieldType, std::size_t Lanes>
+void profile_batch_mul(std::size_t count) {
+    using value_type = typename FieldType::value_type;
+    using batch_type = fields::detail::element_fp_batch<fields::params<FieldType>, Lanes>;
+
+    std::vector<value_type> a, b;
+    for (std::size_t i = 0; i < count * Lanes; ++i) {
+        a.push_back(random_element<FieldType>());
+        b.push_back(random_element<FieldType>());
+    }
+
+    std::vector<batch_type> a_batches, b_batches;
+    for (std::size_t i = 0; i < count; ++i) {
+        a_batches.emplace_back(a.begin() + i * Lanes, a.begin() + (i + 1) * Lanes);
+        b_batches.emplace_back(b.begin() + i * Lanes, b.begin() + (i + 1) * Lanes);
+    }
+
+    const std::size_t rounds = 100;
+
+    std::vector<value_type> scalar_answers(a);
+    long long start_time = get_nsec_time();
+    for (std::size_t r = 0; r < rounds; ++r) {
+        for (std::size_t i = 0; i < scalar_answers.size(); ++i) {
+            scalar_answers[i] = scalar_answers[i] * b[i];
+        }
+    }
+    long long scalar_time = get_nsec_time() - start_time;
+
+    std::vector<batch_type> batch_answers(a_batches);
+    start_time = get_nsec_time();
+    for (std::size_t r = 0; r < rounds; ++r) {
+        for (std::size_t i = 0; i < batch_answers.size(); ++i) {
+            batch_answers[i] *= b_batches[i];
+        }
+    }
+    long long batch_time = get_nsec_time() - start_time;
+
+    const double operations = static_cast<double>(rounds * count * Lanes);
+    printf("%zu lanes, ifma %d:\telement_fp %.1f ns/mul\telement_fp_batch %.1f ns/mul\n", Lanes,
+           batch_type::lanes_type::has_avx512ifma(), scalar_time / operations, batch_time / operations);
+
+    std::vector<value_type> unpacked;
+    for (const batch_type &batch : batch_answers) {
+        batch.store(std::back_inserter(unpacked));
+    }
+    if (unpacked != scalar_answers) {
+        fprintf(stderr, "Answers NOT MATCHING\n");
+    }
+}
+
+int main() {
+
+    std::cout << "Testing BLS12-381 Fr" << std::endl;
+    profile_batch_mul<fields::bls12_fr<381>, 8>(1000);
+    profile_batch_mul<fields::bls12_fr<381>, 16>(500);
+
+    std::cout << "Testing BLS12-381 Fq" << std::endl;
+    profile_batch_mul<fields::bls12_fq<381>, 8>(1000);
+    profile_batch_mul<fields::bls12_fq<381>, 16>(500);
+
+    std::cout << "Testing Pallas Fq" << std::endl;
+    profile_batch_mul<fields::pallas_fq, 8>(1000);
+    profile_batch_mul<fields::pallas_fq, 16>(500);
+
+    return 0;
+}
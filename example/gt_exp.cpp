@@ -0,0 +1,90 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <iostream>
+
+#include <cstdio>
+#include <vector>
+#include <chrono>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+long long get_nsec_time() {
+    auto timepoint = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timepoint.time_since_epoch()).count();
+}
+
+template<typename CurveType>
+void profile_gt_exp(std::size_t count) {
+    using scalar_field_type = typename CurveType::scalar_field_type;
+    using integral_type = typename scalar_field_type::integral_type;
+    using gt_value_type = typename CurveType::gt_type::value_type;
+
+    const gt_value_type e = pair_reduced<CurveType>(random_element<typename CurveType::template g1_type<>>(),
+                                                    random_element<typename CurveType::template g2_type<>>());
+
+    std::vector<integral_type> exponents;
+    for (std::size_t i = 0; i < count; ++i) {
+        exponents.push_back(random_element<scalar_field_type>().data.template convert_to<integral_type>());
+    }
+
+    std::vector<gt_value_type> pow_answers, cyclotomic_answers, gt_exp_answers;
+
+    long long start_time = get_nsec_time();
+    for (const integral_type &exponent : exponents) {
+        pow_answers.push_back(e.pow(exponent));
+    }
+    printf("pow\t\t%lld ns/op\n", (get_nsec_time() - start_time) / static_cast<long long>(count));
+
+    start_time = get_nsec_time();
+    for (const integral_type &exponent : exponents) {
+        cyclotomic_answers.push_back(e.cyclotomic_exp(exponent));
+    }
+    printf("cyclotomic_exp\t%lld ns/op\n", (get_nsec_time() - start_time) / static_cast<long long>(count));
+
+    start_time = get_nsec_time();
+    for (const integral_type &exponent : exponents) {
+        gt_exp_answers.push_back(gt_exp<CurveType>(e, exponent));
+    }
+    printf("gt_exp\t\t%lld ns/op\n", (get_nsec_time() - start_time) / static_cast<long long>(count));
+
+    if (pow_answers != cyclotomic_answers || pow_answers != gt_exp_answers) {
+        fprintf(stderr, "Answers NOT MATCHING\n");
+    }
+}
+
+int main() {
+
+    std::cout << "Testing BLS12-381 GT" << std::endl;
+    profile_gt_exp<curves::bls12<381>>(100);
+
+    return 0;
+}
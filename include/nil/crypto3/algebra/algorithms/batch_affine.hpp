@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_AFFINE_HPP
+#define CRYPTO3_ALGEBRA_BATCH_AFFINE_HPP
+
+#include <iterator>
+#include <vector>
+
+#include <nil/crypto3/algebra/algorithms/batch_inversion.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            /*!
+             * @brief Replaces every P of [first, last) by P + Q, Q running over the range starting at other, for
+             * curve elements in affine coordinates. All the additions share one field inversion.
+             *
+             * Each addition costs the multiplications of its formula plus 3 for the shared inversion, instead of an
+             * inversion of its own, which is what keeps batched algorithms (bucket accumulation of multiexp, many
+             * independent scalar multiplications) in affine coordinates. Pairs the affine formulas cannot add (a zero
+             * operand, P == Q, P == -Q) are left to operator+.
+             */
+            template<typename ForwardIterator1, typename ForwardIterator2>
+            void batch_affine_add(ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 other) {
+                typedef typename std::iterator_traits<ForwardIterator1>::value_type value_type;
+                typedef typename value_type::field_type::value_type field_value_type;
+
+                std::vector<field_value_type> inverses;
+                ForwardIterator2 q = other;
+                for (ForwardIterator1 p = first; p != last; ++p, ++q) {
+                    inverses.push_back((p->is_zero() || q->is_zero()) ? field_value_type::zero() :
+                                                                        p->addition_denominator(*q));
+                }
+
+                batch_inversion(inverses.begin(), inverses.end(), inverses.begin());
+
+                q = other;
+                typename std::vector<field_value_type>::const_iterator inverse = inverses.begin();
+                for (ForwardIterator1 p = first; p != last; ++p, ++q, ++inverse) {
+                    if (inverse->is_zero()) {
+                        *p = *p + *q;
+                    } else {
+                        *p = p->add_with_inverse(*q, *inverse);
+                    }
+                }
+            }
+
+            /*!
+             * @brief Doubles every curve element of [first, last), given in affine coordinates, in place with one
+             * field inversion for the whole range. Points the affine formulas cannot double are left to doubled().
+             */
+            template<typename ForwardIterator>
+            void batch_affine_double(ForwardIterator first, ForwardIterator last) {
+                typedef typename std::iterator_traits<ForwardIterator>::value_type value_type;
+                typedef typename value_type::field_type::value_type field_value_type;
+
+                std::vector<field_value_type> inverses;
+                for (ForwardIterator p = first; p != last; ++p) {
+                    inverses.push_back(p->is_zero() ? field_value_type::zero() : p->doubling_denominator());
+                }
+
+                batch_inversion(inverses.begin(), inverses.end(), inverses.begin());
+
+                typename std::vector<field_value_type>::const_iterator inverse = inverses.begin();
+                for (ForwardIterator p = first; p != last; ++p, ++inverse) {
+                    if (inverse->is_zero()) {
+                        *p = p->doubled();
+                    } else {
+                        *p = p->doubled_with_inverse(*inverse);
+                    }
+                }
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_AFFINE_HPP
@@ -0,0 +1,80 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_INVERSION_HPP
+#define CRYPTO3_ALGEBRA_BATCH_INVERSION_HPP
+
+#include <iterator>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            /*!
+             * @brief Inverts every element of [first, last) with a single field inversion (Montgomery's trick).
+             *
+             * Costs one inversion and 3(n - 1) multiplications. Zero elements are passed through as zero, so
+             * callers that treat "inverse of zero" as zero (e.g. inv0 of the hash-to-curve draft) keep working.
+             * out may alias first.
+             */
+            template<typename InputIterator, typename OutputIterator>
+            OutputIterator batch_inversion(InputIterator first, InputIterator last, OutputIterator out) {
+                typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+
+                std::vector<value_type> elements(first, last);
+                if (elements.empty()) {
+                    return out;
+                }
+
+                // prefix[i] = product of the nonzero elements before i
+                std::vector<value_type> prefix(elements.size());
+                value_type acc = value_type::one();
+                for (std::size_t i = 0; i < elements.size(); ++i) {
+                    prefix[i] = acc;
+                    if (!elements[i].is_zero()) {
+                        acc = acc * elements[i];
+                    }
+                }
+
+                value_type acc_inv = acc.inversed();
+                for (std::size_t i = elements.size(); i-- > 0;) {
+                    if (elements[i].is_zero()) {
+                        continue;
+                    }
+                    const value_type inv = acc_inv * prefix[i];
+                    acc_inv = acc_inv * elements[i];
+                    elements[i] = inv;
+                }
+
+                for (const value_type &e : elements) {
+                    *out++ = e;
+                }
+                return out;
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_INVERSION_HPP
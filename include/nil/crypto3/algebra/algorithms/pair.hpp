@@ -108,6 +108,14 @@ namespace nil {
                 return PairingPolicy::final_exponentiation::process(elt);
             }
 
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename ExponentType>
+            typename PairingCurveType::gt_type::value_type
+                gt_exp(const typename PairingCurveType::gt_type::value_type &elt, const ExponentType &exponent) {
+
+                return PairingPolicy::gt_exp::process(elt, exponent);
+            }
+
             template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
             typename PairingCurveType::gt_type::value_type
                 miller_loop(const typename PairingPolicy::g1_precomputed_type &prec_P,
@@ -30,6 +30,7 @@
 #include <nil/crypto3/algebra/curves/detail/alt_bn128/types.hpp>
 #include <nil/crypto3/algebra/curves/detail/alt_bn128/g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/alt_bn128/g2.hpp>
+#include <nil/crypto3/algebra/curves/detail/alt_bn128/endomorphisms.hpp>
 
 //#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
 //#include <nil/crypto3/algebra/pairing/detail/alt_bn128/functions.hpp>
@@ -31,6 +31,7 @@
 
 #include <nil/crypto3/algebra/curves/detail/bls12/g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/bls12/g2.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/endomorphisms.hpp>
 
 // #include <nil/crypto3/algebra/pairing/bls12.hpp>
 // #include <nil/crypto3/algebra/pairing/detail/bls12/functions.hpp>
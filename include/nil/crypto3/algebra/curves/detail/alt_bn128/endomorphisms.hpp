@@ -0,0 +1,136 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_ALT_BN128_ENDOMORPHISMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_ALT_BN128_ENDOMORPHISMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/alt_bn128/types.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/detail/literals.hpp>
+
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief The untwist-Frobenius-twist endomorphism of alt_bn128 G2 and the subgroup membership
+                     * test built on it. Points are expected in Jacobian or homogeneous projective coordinates.
+                     *    @tparam Version version of the curve
+                     *
+                     */
+                    template<std::size_t Version>
+                    struct alt_bn128_endomorphisms;
+
+                    template<>
+                    struct alt_bn128_endomorphisms<254> {
+                        using integral_type = typename alt_bn128_types<254>::integral_type;
+                        using g2_field_value_type = typename alt_bn128_types<254>::g2_field_type::value_type;
+
+                        constexpr static const std::uint64_t x = 0x44e992b44a6909f1;    ///< the BN parameter
+
+                        ///< psi(x, y) = (psi_x * conj(x), psi_y * conj(y)), psi_x = (9 + u)^((p - 1) / 3)
+                        constexpr static const integral_type psi_x_c0 =
+                            0x2fb347984f7911f74c0bec3cf559b143b78cc310c2c3330c99e39557176f553d_cppui254;
+                        constexpr static const integral_type psi_x_c1 =
+                            0x16c9e55061ebae204ba4cc8bd75a079432ae2a1d0b7c9dce1665d51c640fcba2_cppui254;
+                        ///< psi_y = (9 + u)^((p - 1) / 2)
+                        constexpr static const integral_type psi_y_c0 =
+                            0x063cf305489af5dcdc5ec698b6e2f9b9dbaae0eda9c95998dc54014671a0135a_cppui254;
+                        constexpr static const integral_type psi_y_c1 =
+                            0x07c03cbcac41049a0704b5a7ec796f2b21807dc98fa25bd282d37f632623b0e3_cppui254;
+
+                        /** @brief [x]P by double-and-add */
+                        template<typename GroupValueType>
+                        static GroupValueType mul_by_x(const GroupValueType &P) {
+                            GroupValueType result = P;
+                            for (int i = 61; i >= 0; --i) {
+                                result.double_inplace();
+                                if ((x >> i) & 1) {
+                                    result += P;
+                                }
+                            }
+                            return result;
+                        }
+
+                        /** @brief psi = twist^-1 o Frobenius o twist on G2 */
+                        template<typename G2ValueType>
+                        static G2ValueType psi(const G2ValueType &P) {
+                            static const g2_field_value_type cx = g2_field_value_type(psi_x_c0, psi_x_c1);
+                            static const g2_field_value_type cy = g2_field_value_type(psi_y_c0, psi_y_c1);
+                            return G2ValueType(P.X.Frobenius_map(1) * cx, P.Y.Frobenius_map(1) * cy,
+                                               P.Z.Frobenius_map(1));
+                        }
+
+                        /** @brief Membership in G2 by the test of El Housni, Guillevic and Piellard:
+                         * [x + 1]P + psi([x]P) + psi^2([x]P) = psi^3([2x]P)
+                         */
+                        template<typename G2ValueType>
+                        static bool is_in_g2(const G2ValueType &P) {
+                            G2ValueType xP = mul_by_x(P);
+                            G2ValueType t = psi(xP);
+                            G2ValueType lhs = xP + P + t + psi(t);
+                            return lhs == psi(psi(psi(xP.doubled())));
+                        }
+                    };
+
+                    constexpr std::uint64_t const alt_bn128_endomorphisms<254>::x;
+                    constexpr typename alt_bn128_endomorphisms<254>::integral_type const
+                        alt_bn128_endomorphisms<254>::psi_x_c0;
+                    constexpr typename alt_bn128_endomorphisms<254>::integral_type const
+                        alt_bn128_endomorphisms<254>::psi_x_c1;
+                    constexpr typename alt_bn128_endomorphisms<254>::integral_type const
+                        alt_bn128_endomorphisms<254>::psi_y_c0;
+                    constexpr typename alt_bn128_endomorphisms<254>::integral_type const
+                        alt_bn128_endomorphisms<254>::psi_y_c1;
+
+                    /** @brief G1 of alt_bn128 has cofactor 1, so every point on the curve is in the subgroup */
+                    template<std::size_t Version>
+                    struct subgroup_check_policy<alt_bn128_g1_params<Version, forms::short_weierstrass>> {
+                        template<typename GroupValueType>
+                        static bool process(const GroupValueType &) {
+                            return true;
+                        }
+                    };
+
+                    template<std::size_t Version>
+                    struct subgroup_check_policy<alt_bn128_g2_params<Version, forms::short_weierstrass>> {
+                        template<typename GroupValueType>
+                        static bool process(const GroupValueType &P) {
+                            return alt_bn128_endomorphisms<Version>::is_in_g2(P);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_ALT_BN128_ENDOMORPHISMS_HPP
@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_377_JACOBI_INTERSECTIONS_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_377_JACOBI_INTERSECTIONS_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/types.hpp>
+
+#include <nil/crypto3/detail/literals.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief Jacobi intersection form of BLS12-377 G1, obtained from the Jacobi quartic form
+                     * with the coefficient d brought to 1 by scaling by mu.
+                     */
+                    template<>
+                    struct bls12_params<377, forms::jacobi_intersections> {
+
+                        using base_field_type = typename bls12_types<377>::base_field_type;
+                        using scalar_field_type = typename bls12_types<377>::scalar_field_type;
+
+                        /// coefficient of Jacobi intersection $s^2+c^2=1, a*s^2+d^2=1$
+                        constexpr static const typename bls12_types<377>::integral_type a =
+                            typename bls12_types<377>::integral_type(
+                                0x9B3AF05DD14F6EC619AAF7D34594AABC5ED1347970DEC00452217CC900000008508C00000000002_cppui316);
+                        /// fourth root of the Jacobi quartic coefficient -3 used by the map from short Weierstrass form
+                        constexpr static const typename bls12_types<377>::integral_type mu =
+                            typename bls12_types<377>::integral_type(
+                                0x52498CF327B862A189750A3F72A8BA720DCB06F5CE476A35982AABE9407C8907828EF1AD4632D72E40FDE5907756C3_cppui375);
+                    };
+
+                    template<>
+                    struct bls12_g1_params<377, forms::jacobi_intersections>
+                        : public bls12_params<377, forms::jacobi_intersections> {
+
+                        using field_type = typename bls12_types<377>::g1_field_type;
+
+                        template<typename Coordinates>
+                        using group_type = bls12_types<377>::g1_type<forms::jacobi_intersections, Coordinates>;
+
+                        constexpr static const std::array<typename field_type::value_type, 3> one_fill = {
+                            typename field_type::value_type(
+                                0x155752C32E98AD94A066B76344755FCCFAAB45FBAFB8FAD713092C28D814FEA63B802B4F16B859E7E2A1430DF04691B_cppui377),
+                            typename field_type::value_type(
+                                0x186DC726C0DB6FDDDDA50F1DF0807AA03ECCC3E1A7805567DB3C2568BFDA5EF8C1EBF268A25FBB42AA6EE588C57098E_cppui377),
+                            typename field_type::value_type(
+                                0xD6DD137A3092C46E6008AA1DD943BB259D9073A7EB0A1B296A8911C94A1ED4E099016FDBCF521D7DA852E79E7673DE_cppui376)};
+                    };
+
+                    constexpr typename bls12_types<377>::integral_type const
+                        bls12_params<377, forms::jacobi_intersections>::a;
+                    constexpr typename bls12_types<377>::integral_type const
+                        bls12_params<377, forms::jacobi_intersections>::mu;
+
+                    constexpr std::array<
+                        typename bls12_g1_params<377, forms::jacobi_intersections>::field_type::value_type,
+                        3> const bls12_g1_params<377, forms::jacobi_intersections>::one_fill;
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_377_JACOBI_INTERSECTIONS_PARAMS_HPP
@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_377_JACOBI_QUARTICS_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_377_JACOBI_QUARTICS_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/types.hpp>
+
+#include <nil/crypto3/detail/literals.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief Jacobi quartic form of BLS12-377 G1, obtained from the point (-1, 0) of order 2 of
+                     * the short Weierstrass curve $y^2=x^3+1$.
+                     */
+                    template<>
+                    struct bls12_params<377, forms::jacobi_quartics> {
+
+                        using base_field_type = typename bls12_types<377>::base_field_type;
+                        using scalar_field_type = typename bls12_types<377>::scalar_field_type;
+
+                        constexpr static const typename bls12_types<377>::integral_type a =
+                            typename bls12_types<377>::integral_type(
+                                0x03);    ///< coefficient of Jacobi quartic curve $y^2=d*x^4+2*a*x^2+1$
+                        /// coefficient of Jacobi quartic curve $y^2=d*x^4+2*a*x^2+1$, equal to -3
+                        constexpr static const typename bls12_types<377>::integral_type d =
+                            typename bls12_types<377>::integral_type(
+                                0x1AE3A4617C510EAC63B05C06CA1493B1A22D9F300F5138F1EF3622FBA094800170B5D44300000008508BFFFFFFFFFFE_cppui377);
+                    };
+
+                    template<>
+                    struct bls12_g1_params<377, forms::jacobi_quartics>
+                        : public bls12_params<377, forms::jacobi_quartics> {
+
+                        using field_type = typename bls12_types<377>::g1_field_type;
+
+                        template<typename Coordinates>
+                        using group_type = bls12_types<377>::g1_type<forms::jacobi_quartics, Coordinates>;
+
+                        constexpr static const std::array<typename field_type::value_type, 2> one_fill = {
+                            typename field_type::value_type(
+                                0x88C9FD049EB4D5E6332B776880B4DFD136CDE98B83759595CC6D8EA56252EE497DFE149FADB4700CA4F07EBE45CC50_cppui376),
+                            typename field_type::value_type(
+                                0x11A66B1A59B8E70D1444F01311A1E39896F6B422459BB9945783BE827497DEF71719DCE5BA03EB00534031D89B1CA03_cppui377)};
+                    };
+
+                    constexpr
+                        typename bls12_types<377>::integral_type const bls12_params<377, forms::jacobi_quartics>::a;
+                    constexpr
+                        typename bls12_types<377>::integral_type const bls12_params<377, forms::jacobi_quartics>::d;
+
+                    constexpr std::array<
+                        typename bls12_g1_params<377, forms::jacobi_quartics>::field_type::value_type,
+                        2> const bls12_g1_params<377, forms::jacobi_quartics>::one_fill;
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_377_JACOBI_QUARTICS_PARAMS_HPP
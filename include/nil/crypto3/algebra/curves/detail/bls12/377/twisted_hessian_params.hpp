@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_377_TWISTED_HESSIAN_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_377_TWISTED_HESSIAN_PARAMS_HPP
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/types.hpp>
+
+#include <nil/crypto3/detail/literals.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief Twisted Hessian form of BLS12-377 G1. The short Weierstrass curve $y^2=x^3+1$ has
+                     * the rational point (0, 1) of order 3, which the map sends to a twisted Hessian curve with d = 0.
+                     */
+                    template<>
+                    struct bls12_params<377, forms::twisted_hessian> {
+
+                        using base_field_type = typename bls12_types<377>::base_field_type;
+                        using scalar_field_type = typename bls12_types<377>::scalar_field_type;
+
+                        /// coefficient of twisted Hessian curve $a*x^3+y^3+1=d*x*y$, equal to -54
+                        constexpr static const typename bls12_types<377>::integral_type a =
+                            typename bls12_types<377>::integral_type(
+                                0x1AE3A4617C510EAC63B05C06CA1493B1A22D9F300F5138F1EF3622FBA094800170B5D44300000008508BFFFFFFFFFCB_cppui377);
+                        constexpr static const typename bls12_types<377>::integral_type d =
+                            typename bls12_types<377>::integral_type(
+                                0x00);    ///< coefficient of twisted Hessian curve $a*x^3+y^3+1=d*x*y$
+                        /// primitive cube root of unity used by the map from short Weierstrass form
+                        constexpr static const typename bls12_types<377>::integral_type omega =
+                            typename bls12_types<377>::integral_type(
+                                0x9B3AF05DD14F6EC619AAF7D34594AABC5ED1347970DEC00452217CC900000008508C00000000001_cppui316);
+                    };
+
+                    template<>
+                    struct bls12_g1_params<377, forms::twisted_hessian>
+                        : public bls12_params<377, forms::twisted_hessian> {
+
+                        using field_type = typename bls12_types<377>::g1_field_type;
+
+                        template<typename Coordinates>
+                        using group_type = bls12_types<377>::g1_type<forms::twisted_hessian, Coordinates>;
+
+                        constexpr static const std::array<typename field_type::value_type, 2> one_fill = {
+                            typename field_type::value_type(
+                                0x150098178C7734249F05355D50393911EB83E448F0DDAA2CDEECB0F2AE748C7C6D79811BA9A715BC8967B1A89DCD0B3_cppui377),
+                            typename field_type::value_type(
+                                0xD45E1D1727991E45C459A3B816819D13E871A563EBEC1C78D3CB25AC9FF353914AEFFB5283EDD70685173086D1460D_cppui376)};
+                    };
+
+                    constexpr
+                        typename bls12_types<377>::integral_type const bls12_params<377, forms::twisted_hessian>::a;
+                    constexpr
+                        typename bls12_types<377>::integral_type const bls12_params<377, forms::twisted_hessian>::d;
+                    constexpr
+                        typename bls12_types<377>::integral_type const bls12_params<377, forms::twisted_hessian>::omega;
+
+                    constexpr std::array<
+                        typename bls12_g1_params<377, forms::twisted_hessian>::field_type::value_type,
+                        2> const bls12_g1_params<377, forms::twisted_hessian>::one_fill;
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_377_TWISTED_HESSIAN_PARAMS_HPP
@@ -0,0 +1,235 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_BLS12_ENDOMORPHISMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_BLS12_ENDOMORPHISMS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/bls12/types.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/detail/literals.hpp>
+
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief Efficient endomorphisms of BLS12 curves and what they are used for: cofactor clearing
+                     * and subgroup membership tests. Points are expected in Jacobian or homogeneous projective
+                     * coordinates.
+                     *    @tparam Version version of the curve
+                     *
+                     */
+                    template<std::size_t Version>
+                    struct bls12_endomorphism_params;
+
+                    template<>
+                    struct bls12_endomorphism_params<381> {
+                        using integral_type = typename bls12_types<381>::integral_type;
+
+                        constexpr static const std::uint64_t z_abs = 0xd201000000010000;    ///< z = -z_abs
+                        constexpr static const bool z_is_neg = true;
+
+                        ///< primitive cube root of unity with phi(P) = [-z^2]P on G1
+                        constexpr static const integral_type beta =
+                            0x5f19672fdf76ce51ba69c6076a0f77eaddb3a93be6f89688de17d813620a00022e01fffffffefffe_cppui381;
+
+                        ///< psi(x, y) = (psi_x * conj(x), psi_y * conj(y)), psi_x = 1 / (1 + u)^((p - 1) / 3)
+                        constexpr static const integral_type psi_x_c0 = 0x00_cppui381;
+                        constexpr static const integral_type psi_x_c1 =
+                            0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaad_cppui381;
+                        ///< psi_y = 1 / (1 + u)^((p - 1) / 2)
+                        constexpr static const integral_type psi_y_c0 =
+                            0x135203e60180a68ee2e9c448d77a2cd91c3dedd930b1cf60ef396489f61eb45e304466cf3e67fa0af1ee7b04121bdea2_cppui381;
+                        constexpr static const integral_type psi_y_c1 =
+                            0x6af0e0437ff400b6831e36d6bd17ffe48395dabc2d3435e77f76e17009241c5ee67992f72ec05f4c81084fbede3cc09_cppui381;
+                        ///< psi^2(x, y) = (psi2_x * x, -y), psi2_x = 1 / 2^((p - 1) / 3)
+                        constexpr static const integral_type psi2_x =
+                            0x1a0111ea397fe699ec02408663d4de85aa0d857d89759ad4897d29650fb85f9b409427eb4f49fffd8bfd00000000aaac_cppui381;
+                    };
+
+                    template<>
+                    struct bls12_endomorphism_params<377> {
+                        using integral_type = typename bls12_types<377>::integral_type;
+
+                        constexpr static const std::uint64_t z_abs = 0x8508c00000000001;    ///< z = z_abs
+                        constexpr static const bool z_is_neg = false;
+
+                        ///< primitive cube root of unity with phi(P) = [-z^2]P on G1
+                        constexpr static const integral_type beta =
+                            0x1ae3a4617c510eabc8756ba8f8c524eb8882a75cc9bc8e359064ee822fb5bffd1e945779fffffffffffffffffffffff_cppui377;
+
+                        ///< the twist is of D-type with xi = u, so psi_x = xi^((p - 1) / 3) lies in Fp
+                        constexpr static const integral_type psi_x_c0 =
+                            0x9b3af05dd14f6ec619aaf7d34594aabc5ed1347970dec00452217cc900000008508c00000000002_cppui377;
+                        constexpr static const integral_type psi_x_c1 = 0x00_cppui377;
+                        ///< psi_y = xi^((p - 1) / 2)
+                        constexpr static const integral_type psi_y_c0 =
+                            0x1680a40796537cac0c534db1a79beb1400398f50ad1dec1bce649cf436b0f6299588459bff27d8e6e76d5ecf1391c63_cppui377;
+                        constexpr static const integral_type psi_y_c1 = 0x00_cppui377;
+                        ///< psi2_x = psi_x^2
+                        constexpr static const integral_type psi2_x =
+                            0x9b3af05dd14f6ec619aaf7d34594aabc5ed1347970dec00452217cc900000008508c00000000001_cppui377;
+                    };
+
+                    template<std::size_t Version>
+                    struct bls12_endomorphisms : public bls12_endomorphism_params<Version> {
+                        using params_type = bls12_endomorphism_params<Version>;
+
+                        using integral_type = typename bls12_types<Version>::integral_type;
+                        using g1_field_value_type = typename bls12_types<Version>::g1_field_type::value_type;
+                        using g2_field_value_type = typename bls12_types<Version>::g2_field_type::value_type;
+
+                        /** @brief [z]P by double-and-add over the sparse |z| */
+                        template<typename GroupValueType>
+                        static GroupValueType mul_by_z(const GroupValueType &P) {
+                            int top = 63;
+                            while (!((params_type::z_abs >> top) & 1)) {
+                                --top;
+                            }
+
+                            GroupValueType result = P;
+                            for (int i = top - 1; i >= 0; --i) {
+                                result.double_inplace();
+                                if ((params_type::z_abs >> i) & 1) {
+                                    result += P;
+                                }
+                            }
+                            return params_type::z_is_neg ? -result : result;
+                        }
+
+                        /** @brief phi(x, y) = (beta * x, y) on G1 */
+                        template<typename G1ValueType>
+                        static G1ValueType phi(const G1ValueType &P) {
+                            static const g1_field_value_type b = g1_field_value_type(params_type::beta);
+                            return G1ValueType(P.X * b, P.Y, P.Z);
+                        }
+
+                        /** @brief psi = twist^-1 o Frobenius o twist on G2 */
+                        template<typename G2ValueType>
+                        static G2ValueType psi(const G2ValueType &P) {
+                            static const g2_field_value_type cx =
+                                g2_field_value_type(params_type::psi_x_c0, params_type::psi_x_c1);
+                            static const g2_field_value_type cy =
+                                g2_field_value_type(params_type::psi_y_c0, params_type::psi_y_c1);
+                            return G2ValueType(P.X.Frobenius_map(1) * cx, P.Y.Frobenius_map(1) * cy,
+                                               P.Z.Frobenius_map(1));
+                        }
+
+                        /** @brief psi^2 on G2, which needs no Frobenius map */
+                        template<typename G2ValueType>
+                        static G2ValueType psi2(const G2ValueType &P) {
+                            static const g2_field_value_type cx =
+                                g2_field_value_type(params_type::psi2_x, integral_type(0));
+                            return G2ValueType(P.X * cx, -P.Y, P.Z);
+                        }
+
+                        /** @brief [1 - z]P, the effective cofactor of G1 for hash-to-curve */
+                        template<typename G1ValueType>
+                        static G1ValueType clear_cofactor_g1(const G1ValueType &P) {
+                            return P - mul_by_z(P);
+                        }
+
+                        /** @brief [h_eff]P on G2 by the method of Budroni and Pintore:
+                         * [z^2 - z - 1]P + [z - 1]psi(P) + psi^2([2]P)
+                         */
+                        template<typename G2ValueType>
+                        static G2ValueType clear_cofactor_g2(const G2ValueType &P) {
+                            G2ValueType t1 = mul_by_z(P);
+                            G2ValueType t2 = psi(P);
+                            G2ValueType t3 = psi2(P.doubled()) - t2;
+                            t2 = mul_by_z(t1 + t2);
+                            return t3 + t2 - t1 - P;
+                        }
+
+                        /** @brief Membership in G1 by Scott's test phi(P) = [-z^2]P */
+                        template<typename G1ValueType>
+                        static bool is_in_g1(const G1ValueType &P) {
+                            return (phi(P) + mul_by_z(mul_by_z(P))).is_zero();
+                        }
+
+                        /** @brief Membership in G2 by Scott's test psi(P) = [z]P */
+                        template<typename G2ValueType>
+                        static bool is_in_g2(const G2ValueType &P) {
+                            return psi(P) == mul_by_z(P);
+                        }
+                    };
+
+                    template<std::size_t Version>
+                    struct subgroup_check_policy<bls12_g1_params<Version, forms::short_weierstrass>> {
+                        template<typename GroupValueType>
+                        static bool process(const GroupValueType &P) {
+                            return bls12_endomorphisms<Version>::is_in_g1(P);
+                        }
+                    };
+
+                    template<std::size_t Version>
+                    struct subgroup_check_policy<bls12_g2_params<Version, forms::short_weierstrass>> {
+                        template<typename GroupValueType>
+                        static bool process(const GroupValueType &P) {
+                            return bls12_endomorphisms<Version>::is_in_g2(P);
+                        }
+                    };
+
+                    constexpr std::uint64_t const bls12_endomorphism_params<381>::z_abs;
+                    constexpr bool const bls12_endomorphism_params<381>::z_is_neg;
+                    constexpr typename bls12_endomorphism_params<381>::integral_type const
+                        bls12_endomorphism_params<381>::beta;
+                    constexpr typename bls12_endomorphism_params<381>::integral_type const
+                        bls12_endomorphism_params<381>::psi_x_c0;
+                    constexpr typename bls12_endomorphism_params<381>::integral_type const
+                        bls12_endomorphism_params<381>::psi_x_c1;
+                    constexpr typename bls12_endomorphism_params<381>::integral_type const
+                        bls12_endomorphism_params<381>::psi_y_c0;
+                    constexpr typename bls12_endomorphism_params<381>::integral_type const
+                        bls12_endomorphism_params<381>::psi_y_c1;
+                    constexpr typename bls12_endomorphism_params<381>::integral_type const
+                        bls12_endomorphism_params<381>::psi2_x;
+                    constexpr std::uint64_t const bls12_endomorphism_params<377>::z_abs;
+                    constexpr bool const bls12_endomorphism_params<377>::z_is_neg;
+                    constexpr typename bls12_endomorphism_params<377>::integral_type const
+                        bls12_endomorphism_params<377>::beta;
+                    constexpr typename bls12_endomorphism_params<377>::integral_type const
+                        bls12_endomorphism_params<377>::psi_x_c0;
+                    constexpr typename bls12_endomorphism_params<377>::integral_type const
+                        bls12_endomorphism_params<377>::psi_x_c1;
+                    constexpr typename bls12_endomorphism_params<377>::integral_type const
+                        bls12_endomorphism_params<377>::psi_y_c0;
+                    constexpr typename bls12_endomorphism_params<377>::integral_type const
+                        bls12_endomorphism_params<377>::psi_y_c1;
+                    constexpr typename bls12_endomorphism_params<377>::integral_type const
+                        bls12_endomorphism_params<377>::psi2_x;
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_BLS12_ENDOMORPHISMS_HPP
@@ -28,10 +28,17 @@
 #define CRYPTO3_ALGEBRA_CURVES_BLS12_G1_HPP
 
 #include <nil/crypto3/algebra/curves/detail/bls12/377/short_weierstrass_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/377/twisted_hessian_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/377/jacobi_quartics_params.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/377/jacobi_intersections_params.hpp>
 #include <nil/crypto3/algebra/curves/detail/bls12/381/short_weierstrass_params.hpp>
 
 #include <nil/crypto3/algebra/curves/forms.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian_with_a4_0/element_g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_with_a4_0/element_g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_hessian/projective/element_g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_quartics/xyz/element_g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_intersections/projective/element_g1.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -0,0 +1,73 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_CACHED_ELEMENT_HPP
+#define CRYPTO3_ALGEBRA_CURVES_CACHED_ELEMENT_HPP
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief Form in which a point that is added many times (wNAF tables, multiexp bases) is kept.
+                     * Element types exposing cached_type and to_cached() are stored in that form, which the
+                     * element's operator+ and operator- accept; other types are stored as they are.
+                     */
+                    template<typename GroupValueType, bool = has_type_cached_type<GroupValueType>::value>
+                    struct cached_element {
+                        constexpr static const bool value = false;
+
+                        typedef GroupValueType type;
+
+                        static const type &cache(const GroupValueType &P) {
+                            return P;
+                        }
+                    };
+
+                    template<typename GroupValueType>
+                    struct cached_element<GroupValueType, true> {
+                        constexpr static const bool value = true;
+
+                        typedef typename GroupValueType::cached_type type;
+
+                        static type cache(const GroupValueType &P) {
+                            return P.to_cached();
+                        }
+                    };
+
+                    template<typename GroupValueType, bool HasCachedType>
+                    constexpr bool const cached_element<GroupValueType, HasCachedType>::value;
+                    template<typename GroupValueType>
+                    constexpr bool const cached_element<GroupValueType, true>::value;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_CACHED_ELEMENT_HPP
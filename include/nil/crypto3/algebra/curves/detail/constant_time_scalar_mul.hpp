@@ -0,0 +1,350 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_CONSTANT_TIME_SCALAR_MUL_HPP
+#define CRYPTO3_ALGEBRA_CURVES_CONSTANT_TIME_SCALAR_MUL_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief Policy of scalar_mul(base, scalar, policy) for public scalars: double-and-add, which
+                     * branches on the scalar bits and on the special points.
+                     */
+                    struct variable_time { };
+
+                    /**
+                     * @brief Policy of scalar_mul(base, scalar, policy) for secret scalars: regular signed window
+                     * recoding with odd digits over all the bits a scalar may have, table lookups by masked
+                     * selection and complete addition formulas, so the sequence of operations and of memory
+                     * accesses does not depend on the scalar.
+                     *
+                     * Timing is only as independent of the scalar as the field arithmetic underneath.
+                     */
+                    template<std::size_t Window = 4>
+                    struct constant_time {
+                        constexpr static const std::size_t window = Window;
+                    };
+
+                    template<std::size_t Window>
+                    constexpr std::size_t const constant_time<Window>::window;
+
+                    /**
+                     * @brief Sets r to a if mask has all bits set and leaves it as it is if mask is zero, without
+                     * branching on mask.
+                     */
+                    template<typename FieldValueType>
+                    typename std::enable_if<!is_extended_field<typename FieldValueType::field_type>::value>::type
+                        masked_assign(FieldValueType &r, const FieldValueType &a, std::uint64_t mask) {
+                        auto &r_base = r.data.backend().base_data();
+                        const auto &a_base = a.data.backend().base_data();
+
+                        typedef typename std::remove_reference<decltype(*r_base.limbs())>::type limb_type;
+                        constexpr std::size_t limbs_num =
+                            (FieldValueType::field_type::modulus_bits + 8 * sizeof(limb_type) - 1) /
+                            (8 * sizeof(limb_type));
+                        const limb_type limb_mask = static_cast<limb_type>(mask);
+
+                        // limbs above the normalized size are not cleared by the backend
+                        const std::size_t r_size = r_base.size();
+                        r_base.resize(limbs_num, limbs_num);
+                        for (std::size_t i = r_size; i < limbs_num; ++i) {
+                            r_base.limbs()[i] = 0;
+                        }
+
+                        for (std::size_t i = 0; i < limbs_num; ++i) {
+                            const limb_type a_limb = i < a_base.size() ? a_base.limbs()[i] : 0;
+                            r_base.limbs()[i] = (r_base.limbs()[i] & ~limb_mask) | (a_limb & limb_mask);
+                        }
+                        r_base.normalize();
+                    }
+
+                    template<typename FieldValueType>
+                    typename std::enable_if<is_extended_field<typename FieldValueType::field_type>::value>::type
+                        masked_assign(FieldValueType &r, const FieldValueType &a, std::uint64_t mask) {
+                        for (std::size_t i = 0; i < r.data.size(); ++i) {
+                            masked_assign(r.data[i], a.data[i], mask);
+                        }
+                    }
+
+                    /**
+                     * Representation of the points of a constant-time table, their masked selection and the
+                     * complete formulas used to accumulate them. Defined only for the coordinates whose addition
+                     * and doubling are complete and branch free.
+                     */
+                    template<typename GroupValueType,
+                             typename Form = typename GroupValueType::form,
+                             typename Coordinates = typename GroupValueType::coordinates>
+                    struct constant_time_entry;
+
+                    /**
+                     * Projective short Weierstrass points: operator+ runs the complete formulas of
+                     * Renes, Costello and Batina, which also double.
+                     */
+                    template<typename GroupValueType>
+                    struct constant_time_entry<GroupValueType, forms::short_weierstrass, coordinates::projective> {
+                        typedef GroupValueType type;
+
+                        static type make(const GroupValueType &P) {
+                            return P;
+                        }
+
+                        static void assign(type &r, const type &a, std::uint64_t mask) {
+                            masked_assign(r.X, a.X, mask);
+                            masked_assign(r.Y, a.Y, mask);
+                            masked_assign(r.Z, a.Z, mask);
+                        }
+
+                        static void assign_point(GroupValueType &r, const GroupValueType &a, std::uint64_t mask) {
+                            assign(r, a, mask);
+                        }
+
+                        static GroupValueType add(const GroupValueType &acc, const type &P) {
+                            return acc + P;
+                        }
+
+                        // dbl-2007-bl is not complete: it maps the point at infinity to (0:0:0)
+                        static GroupValueType dbl(const GroupValueType &acc) {
+                            return acc + acc;
+                        }
+                    };
+
+                    template<typename GroupValueType>
+                    struct constant_time_entry<GroupValueType, forms::short_weierstrass,
+                                               coordinates::projective_with_a4_0>
+                        : constant_time_entry<GroupValueType, forms::short_weierstrass, coordinates::projective> {
+                        static GroupValueType dbl(const GroupValueType &acc) {
+                            return acc.doubled();
+                        }
+                    };
+
+                    /**
+                     * Extended twisted Edwards points are kept in the cached form, whose addition skips the
+                     * special-point checks of operator+; the unified formulas are complete for square a and
+                     * non-square d. dbl-2008-hwcd is complete as well and has no branch on the point at infinity.
+                     */
+                    template<typename GroupValueType>
+                    struct constant_time_entry<GroupValueType, forms::twisted_edwards, coordinates::extended> {
+                        typedef typename GroupValueType::cached_type type;
+
+                        static type make(const GroupValueType &P) {
+                            return P.to_cached();
+                        }
+
+                        static void assign(type &r, const type &a, std::uint64_t mask) {
+                            masked_assign(r.X, a.X, mask);
+                            masked_assign(r.Y, a.Y, mask);
+                            masked_assign(r.XplusY, a.XplusY, mask);
+                            masked_assign(r.Z, a.Z, mask);
+                            masked_assign(r.Td, a.Td, mask);
+                        }
+
+                        static void assign_point(GroupValueType &r, const GroupValueType &a, std::uint64_t mask) {
+                            masked_assign(r.X, a.X, mask);
+                            masked_assign(r.Y, a.Y, mask);
+                            masked_assign(r.T, a.T, mask);
+                            masked_assign(r.Z, a.Z, mask);
+                        }
+
+                        static GroupValueType add(const GroupValueType &acc, const type &P) {
+                            return acc + P;
+                        }
+
+                        static GroupValueType dbl(const GroupValueType &acc) {
+                            return acc.doubled();
+                        }
+                    };
+
+                    template<typename GroupValueType>
+                    struct constant_time_entry<GroupValueType, forms::twisted_edwards,
+                                               coordinates::extended_with_a_minus_1> {
+                        typedef typename GroupValueType::cached_type type;
+
+                        static type make(const GroupValueType &P) {
+                            return P.to_cached();
+                        }
+
+                        static void assign(type &r, const type &a, std::uint64_t mask) {
+                            masked_assign(r.YplusX, a.YplusX, mask);
+                            masked_assign(r.YminusX, a.YminusX, mask);
+                            masked_assign(r.Z2, a.Z2, mask);
+                            masked_assign(r.T2d, a.T2d, mask);
+                        }
+
+                        static void assign_point(GroupValueType &r, const GroupValueType &a, std::uint64_t mask) {
+                            masked_assign(r.X, a.X, mask);
+                            masked_assign(r.Y, a.Y, mask);
+                            masked_assign(r.T, a.T, mask);
+                            masked_assign(r.Z, a.Z, mask);
+                        }
+
+                        static GroupValueType add(const GroupValueType &acc, const type &P) {
+                            return acc + P;
+                        }
+
+                        static GroupValueType dbl(const GroupValueType &acc) {
+                            return acc.doubled();
+                        }
+                    };
+
+                    template<typename GroupValueType,
+                             typename Backend,
+                             multiprecision::expression_template_option ExpressionTemplates>
+                    GroupValueType scalar_mul(const GroupValueType &base,
+                                              const multiprecision::number<Backend, ExpressionTemplates> &scalar,
+                                              variable_time) {
+                        return scalar_mul(base, scalar);
+                    }
+
+                    /**
+                     * @return all ones if a == b, zero otherwise
+                     */
+                    inline std::uint64_t equal_mask(std::uint64_t a, std::uint64_t b) {
+                        const std::uint64_t difference = a ^ b;
+                        return ((difference | (0 - difference)) >> 63) - 1;
+                    }
+
+                    /**
+                     * @brief Reads table[index], negated if negate is all ones, touching every entry of the table.
+                     */
+                    template<typename EntryPolicy>
+                    typename EntryPolicy::type
+                        constant_time_lookup(const std::vector<typename EntryPolicy::type> &table,
+                                             std::uint64_t index, std::uint64_t negate) {
+                        typename EntryPolicy::type selected = table[0];
+                        for (std::size_t j = 1; j < table.size(); ++j) {
+                            EntryPolicy::assign(selected, table[j], equal_mask(j, index));
+                        }
+                        EntryPolicy::assign(selected, -selected, negate);
+
+                        return selected;
+                    }
+
+                    /**
+                     * @brief Constant-time scalar multiplication, see constant_time.
+                     *
+                     * The odd number k = scalar | 1 is written as sum(d_i * 2^(Window*i)) with odd digits
+                     * d_i = 1 + sum(bit(k, Window*i + j) * 2^j, j = 1 .. Window) - 2^Window, the top one taken
+                     * positive, for as many digits as the larger of the scalar and base field moduli needs. No
+                     * digit is zero, so every step is Window doublings and the addition of one of the odd
+                     * multiples P, 3P, ..., (2^Window - 1)P, and the accumulator never goes through the point at
+                     * infinity. Even scalars get base subtracted at the end by a masked selection.
+                     */
+                    template<typename GroupValueType,
+                             typename Backend,
+                             multiprecision::expression_template_option ExpressionTemplates,
+                             std::size_t Window>
+                    GroupValueType scalar_mul(const GroupValueType &base,
+                                              const multiprecision::number<Backend, ExpressionTemplates> &scalar,
+                                              constant_time<Window>) {
+                        typedef constant_time_entry<GroupValueType> entry_policy;
+                        typedef typename entry_policy::type entry_type;
+
+                        static_assert(Window > 0 && Window < 8, "window does not fit the table");
+
+                        constexpr std::size_t scalar_modulus_bits =
+                            GroupValueType::group_type::curve_type::scalar_field_type::modulus_bits;
+                        constexpr std::size_t base_modulus_bits = GroupValueType::field_type::modulus_bits;
+                        constexpr std::size_t bits =
+                            scalar_modulus_bits > base_modulus_bits ? scalar_modulus_bits : base_modulus_bits;
+                        constexpr std::size_t digits = (bits + Window - 1) / Window;
+                        constexpr std::uint64_t index_mask = (std::uint64_t(1) << (Window - 1)) - 1;
+
+                        BOOST_ASSERT(scalar.is_zero() || multiprecision::msb(scalar) < bits);
+
+                        std::vector<entry_type> table;
+                        table.reserve(std::size_t(1) << (Window - 1));
+                        const entry_type base_doubled = entry_policy::make(entry_policy::dbl(base));
+                        GroupValueType multiple = base;
+                        for (std::size_t j = 0; j < (std::size_t(1) << (Window - 1)); ++j) {
+                            table.emplace_back(entry_policy::make(multiple));
+                            multiple = entry_policy::add(multiple, base_doubled);
+                        }
+
+                        // d = 2 * index + 1 for a positive digit and -(2 * index + 1) for a negative one
+                        std::uint64_t index = 0;
+                        for (std::size_t j = 1; j < Window; ++j) {
+                            index |= std::uint64_t(multiprecision::bit_test(scalar, (digits - 1) * Window + j))
+                                     << (j - 1);
+                        }
+                        GroupValueType result = entry_policy::add(GroupValueType::zero(),
+                                                                  constant_time_lookup<entry_policy>(table, index, 0));
+
+                        for (std::size_t i = digits - 1; i-- > 0;) {
+                            for (std::size_t j = 0; j < Window; ++j) {
+                                result = entry_policy::dbl(result);
+                            }
+
+                            index = 0;
+                            for (std::size_t j = 1; j < Window; ++j) {
+                                index |= std::uint64_t(multiprecision::bit_test(scalar, i * Window + j)) << (j - 1);
+                            }
+                            const std::uint64_t negative =
+                                std::uint64_t(multiprecision::bit_test(scalar, i * Window + Window)) - 1;
+
+                            result = entry_policy::add(
+                                result,
+                                constant_time_lookup<entry_policy>(table, (index ^ negative) & index_mask, negative));
+                        }
+
+                        const GroupValueType corrected = entry_policy::add(result, entry_policy::make(-base));
+                        entry_policy::assign_point(result, corrected,
+                                                   0 - std::uint64_t(!multiprecision::bit_test(scalar, 0)));
+
+                        return result;
+                    }
+
+                    template<typename GroupValueType, typename FieldValueType, std::size_t Window>
+                    typename std::enable_if<is_field<typename FieldValueType::field_type>::value &&
+                                                !is_extended_field<typename FieldValueType::field_type>::value,
+                                            GroupValueType>::type
+                        scalar_mul(const GroupValueType &base, const FieldValueType &scalar, constant_time<Window>) {
+                        return scalar_mul(base,
+                                          scalar.data.template convert_to<typename FieldValueType::integral_type>(),
+                                          constant_time<Window>());
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_CONSTANT_TIME_SCALAR_MUL_HPP
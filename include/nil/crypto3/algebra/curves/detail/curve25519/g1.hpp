@@ -28,7 +28,8 @@
 #define CRYPTO3_ALGEBRA_CURVES_CURVE25519_G1_HPP
 
 #include <nil/crypto3/algebra/curves/detail/curve25519/params.hpp>
-// #include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/element_g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/element_g1_affine.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/element_g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/element_g1.hpp>
 
 namespace nil {
@@ -44,10 +44,10 @@ namespace nil {
                         using base_field_type = typename curve25519_types::base_field_type;
                         using scalar_field_type = typename curve25519_types::scalar_field_type;
 
-                        constexpr static typename curve25519_types::integral_type a =
+                        constexpr static typename curve25519_types::integral_type A =
                             typename curve25519_types::integral_type(
                                 0x76d06);    ///< coefficient of Montgomery curve $b*y^2=x^3+a*x^2+x$
-                        constexpr static typename curve25519_types::integral_type b =
+                        constexpr static typename curve25519_types::integral_type B =
                             typename curve25519_types::integral_type(
                                 0x01);    ///< coefficient of Montgomery curve $b*y^2=x^3+a*x^2+x$
                     };
@@ -110,8 +110,8 @@ namespace nil {
                                 0x6666666666666666666666666666666666666666666666666666666666666658_cppui255)};
                     };
 
-                    constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::a;
-                    constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::b;
+                    constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::A;
+                    constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::B;
 
                     constexpr std::array<typename curve25519_g1_params<forms::montgomery>::field_type::value_type, 2>
                         curve25519_g1_params<forms::montgomery>::zero_fill;
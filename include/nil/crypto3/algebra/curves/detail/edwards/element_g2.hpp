@@ -28,6 +28,7 @@
 #define CRYPTO3_ALGEBRA_CURVES_EDWARDS_G2_ELEMENT_HPP
 
 #include <nil/crypto3/algebra/curves/detail/edwards/basic_policy.hpp>
+#include <nil/crypto3/algebra/curves/detail/inplace_arithmetic.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
 
@@ -52,7 +53,8 @@ namespace nil {
                      *
                      */
                     template<>
-                    struct element_edwards_g2<183> {
+                    struct element_edwards_g2<183>
+                        : public inplace_arithmetic<element_edwards_g2<183>> {
 
                         using group_type = edwards_g2<183, forms::twisted_edwards, coordinates::inverted>;
 
@@ -153,7 +155,7 @@ namespace nil {
 
                         /*************************  Arithmetic operations  ***********************************/
 
-                        constexpr element_edwards_g2 operator=(const element_edwards_g2 &other) {
+                        constexpr element_edwards_g2 &operator=(const element_edwards_g2 &other) {
                             // handle special cases having to do with O
                             this->X = other.X;
                             this->Y = other.Y;
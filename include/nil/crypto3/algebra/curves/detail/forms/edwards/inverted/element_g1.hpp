@@ -28,6 +28,7 @@
 #define CRYPTO3_ALGEBRA_CURVES_EDWARDS_G1_ELEMENT_INVERTED_HPP
 
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/inplace_arithmetic.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
 
 #include <nil/crypto3/algebra/curves/detail/forms/edwards/coordinates.hpp>
@@ -55,7 +56,8 @@ namespace nil {
                      *
                      */
                     template<typename CurveParams>
-                    struct curve_element<CurveParams, forms::edwards, coordinates::inverted> {
+                    struct curve_element<CurveParams, forms::edwards, coordinates::inverted>
+                        : public inplace_arithmetic<curve_element<CurveParams, forms::edwards, coordinates::inverted>> {
 
                         using params_type = CurveParams;
                         using field_type = typename params_type::field_type;
@@ -181,7 +183,7 @@ namespace nil {
 
                         /*************************  Arithmetic operations  ***********************************/
 
-                        constexpr curve_element operator=(const curve_element &other) {
+                        constexpr curve_element &operator=(const curve_element &other) {
                             // handle special cases having to do with O
                             this->X = other.X;
                             this->Y = other.Y;
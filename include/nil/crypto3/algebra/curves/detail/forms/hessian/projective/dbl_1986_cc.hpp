@@ -0,0 +1,60 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HESSIAN_G1_ELEMENT_PROJECTIVE_DBL_1986_CC_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HESSIAN_G1_ELEMENT_PROJECTIVE_DBL_1986_CC_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing element doubling from the group G1 of Hessian curve
+                     *  for projective coordinates representation (Chudnovsky and Chudnovsky, 1986).
+                     */
+                    struct hessian_element_g1_projective_dbl_1986_cc {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type A = first.X.squared() * first.X;    // A = X1^3
+                            field_value_type B = first.Y.squared() * first.Y;    // B = Y1^3
+                            field_value_type C = first.Z.squared() * first.Z;    // C = Z1^3
+                            field_value_type X3 = first.Y * (A - C);             // X3 = Y1*(A-C)
+                            field_value_type Y3 = first.X * (C - B);             // Y3 = X1*(C-B)
+                            field_value_type Z3 = first.Z * (B - A);             // Z3 = Z1*(B-A)
+
+                            return ElementType(X3, Y3, Z3);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_HESSIAN_G1_ELEMENT_PROJECTIVE_DBL_1986_CC_HPP
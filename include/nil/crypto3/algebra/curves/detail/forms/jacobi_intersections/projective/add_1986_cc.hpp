@@ -0,0 +1,69 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_JACOBI_INTERSECTIONS_G1_ELEMENT_PROJECTIVE_ADD_1986_CC_HPP
+#define CRYPTO3_ALGEBRA_CURVES_JACOBI_INTERSECTIONS_G1_ELEMENT_PROJECTIVE_ADD_1986_CC_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing element addition from the group G1 of Jacobi intersection curve
+                     *  for projective coordinates representation (Chudnovsky and Chudnovsky, 1986).
+                     *  The formulas are unified.
+                     */
+                    struct jacobi_intersections_element_g1_projective_add_1986_cc {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first,
+                                                                    const ElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+                            using params_type = typename ElementType::params_type;
+
+                            field_value_type A = first.S * second.S;                             // A = S1*S2
+                            field_value_type B = first.C * second.C;                             // B = C1*C2
+                            field_value_type D = first.D * second.D;                             // D = D1*D2
+                            field_value_type Z = first.Z * second.Z;                             // Z = Z1*Z2
+                            field_value_type E = first.S * first.Z;                              // E = S1*Z1
+                            field_value_type F = second.C * second.D;                            // F = C2*D2
+                            field_value_type G = first.C * first.D;                              // G = C1*D1
+                            field_value_type H = second.S * second.Z;                            // H = S2*Z2
+                            field_value_type S3 = E * F + G * H;                                 // S3 = E*F+G*H
+                            field_value_type C3 = B * Z - A * D;                                 // C3 = B*Z-A*D
+                            field_value_type D3 = D * Z - A * B * params_type::a;                // D3 = D*Z-a*A*B
+                            field_value_type Z3 = Z.squared() - A.squared() * params_type::a;    // Z3 = Z^2-a*A^2
+
+                            return ElementType(S3, C3, D3, Z3);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_JACOBI_INTERSECTIONS_G1_ELEMENT_PROJECTIVE_ADD_1986_CC_HPP
@@ -0,0 +1,64 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_JACOBI_INTERSECTIONS_G1_ELEMENT_PROJECTIVE_DBL_1986_CC_HPP
+#define CRYPTO3_ALGEBRA_CURVES_JACOBI_INTERSECTIONS_G1_ELEMENT_PROJECTIVE_DBL_1986_CC_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing element doubling from the group G1 of Jacobi intersection curve
+                     *  for projective coordinates representation (Chudnovsky and Chudnovsky, 1986).
+                     */
+                    struct jacobi_intersections_element_g1_projective_dbl_1986_cc {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+                            using params_type = typename ElementType::params_type;
+
+                            field_value_type SS = first.S.squared();                               // SS = S1^2
+                            field_value_type CC = first.C.squared();                               // CC = C1^2
+                            field_value_type DD = first.D.squared();                               // DD = D1^2
+                            field_value_type ZZ = first.Z.squared();                               // ZZ = Z1^2
+                            // S3 = 2*S1*C1*D1*Z1
+                            field_value_type S3 = (first.S * first.C * first.D * first.Z).doubled();
+                            field_value_type C3 = CC * ZZ - SS * DD;                               // C3 = CC*ZZ-SS*DD
+                            field_value_type D3 = DD * ZZ - SS * CC * params_type::a;              // D3 = DD*ZZ-a*SS*CC
+                            field_value_type Z3 = ZZ.squared() - SS.squared() * params_type::a;    // Z3 = ZZ^2-a*SS^2
+
+                            return ElementType(S3, C3, D3, Z3);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_JACOBI_INTERSECTIONS_G1_ELEMENT_PROJECTIVE_DBL_1986_CC_HPP
@@ -0,0 +1,232 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_JACOBI_INTERSECTIONS_G1_ELEMENT_PROJECTIVE_HPP
+#define CRYPTO3_ALGEBRA_CURVES_JACOBI_INTERSECTIONS_G1_ELEMENT_PROJECTIVE_HPP
+
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/inplace_arithmetic.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_intersections/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_intersections/projective/add_1986_cc.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_intersections/projective/dbl_1986_cc.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_intersections/projective/madd_1986_cc.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing a group G1 of elliptic curve.
+                     *    @tparam CurveParams Parameters of the group
+                     *    @tparam Form Form of the curve
+                     *    @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    struct curve_element;
+
+                    /** @brief A struct representing an element from the group G1 of Jacobi intersection curve
+                     *  s^2 + c^2 = 1, a*s^2 + d^2 = 1 of projective coordinates representation (S:C:D:Z).
+                     *  Description: https://hyperelliptic.org/EFD/g1p/auto-jintersect.html
+                     *
+                     */
+                    template<typename CurveParams>
+                    struct curve_element<CurveParams, forms::jacobi_intersections, coordinates::projective>
+                        : public inplace_arithmetic<curve_element<CurveParams, forms::jacobi_intersections, coordinates::projective>> {
+
+                        using params_type = CurveParams;
+                        using field_type = typename params_type::field_type;
+
+                    private:
+                        using field_value_type = typename field_type::value_type;
+
+                        using common_addition_processor = jacobi_intersections_element_g1_projective_add_1986_cc;
+                        using common_doubling_processor = jacobi_intersections_element_g1_projective_dbl_1986_cc;
+                        using mixed_addition_processor = jacobi_intersections_element_g1_projective_madd_1986_cc;
+
+                    public:
+                        using form = forms::jacobi_intersections;
+                        using coordinates = coordinates::projective;
+
+                        using group_type = typename params_type::template group_type<coordinates>;
+
+                        field_value_type S;
+                        field_value_type C;
+                        field_value_type D;
+                        field_value_type Z;
+
+                        /*************************  Constructors and zero/one  ***********************************/
+
+                        /** @brief
+                         *    @return the point at infinity by default
+                         *
+                         */
+                        constexpr curve_element() :
+                            curve_element(field_value_type::zero(),
+                                          field_value_type::one(),
+                                          field_value_type::one(),
+                                          field_value_type::one()) {};
+
+                        /** @brief
+                         *    @return the selected point (S:C:D:Z)
+                         *
+                         */
+                        constexpr curve_element(field_value_type S,
+                                                field_value_type C,
+                                                field_value_type D,
+                                                field_value_type Z) {
+                            this->S = S;
+                            this->C = C;
+                            this->D = D;
+                            this->Z = Z;
+                        };
+
+                        /** @brief Get the point at infinity
+                         *
+                         */
+                        constexpr static curve_element zero() {
+                            return curve_element();
+                        }
+
+                        /** @brief Get the generator of group G1
+                         *
+                         */
+                        constexpr static curve_element one() {
+                            return curve_element(params_type::one_fill[0],
+                                                 params_type::one_fill[1],
+                                                 params_type::one_fill[2],
+                                                 field_value_type::one());
+                        }
+
+                        /*************************  Comparison operations  ***********************************/
+
+                        constexpr bool operator==(const curve_element &other) const {
+                            // S, C and D are all non-zero on the points with Z = 0, so S1/S2 decides for those
+                            return (this->S * other.Z) == (other.S * this->Z) &&
+                                   (this->C * other.Z) == (other.C * this->Z) &&
+                                   (this->D * other.Z) == (other.D * this->Z) &&
+                                   (this->S * other.C) == (other.S * this->C) &&
+                                   (this->S * other.D) == (other.S * this->D);
+                        }
+
+                        constexpr bool operator!=(const curve_element &other) const {
+                            return !(operator==(other));
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 is the point at infinity
+                         */
+                        constexpr bool is_zero() const {
+                            // the neutral element is (0:1:1:1)
+                            return this->S.is_zero() && this->C == this->Z && this->D == this->Z;
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 lies on the elliptic curve
+                         *
+                         * A check, that S^2 + C^2 = Z^2 and a*S^2 + D^2 = Z^2
+                         */
+                        constexpr bool is_well_formed() const {
+                            field_value_type SS = this->S.squared();
+                            field_value_type ZZ = this->Z.squared();
+
+                            return !(this->S.is_zero() && this->Z.is_zero()) && SS + this->C.squared() == ZZ &&
+                                   field_value_type(params_type::a) * SS + this->D.squared() == ZZ;
+                        }
+
+                        /*************************  Arithmetic operations  ***********************************/
+
+                        constexpr curve_element &operator=(const curve_element &other) {
+                            // handle special cases having to do with O
+                            this->S = other.S;
+                            this->C = other.C;
+                            this->D = other.D;
+                            this->Z = other.Z;
+
+                            return *this;
+                        }
+
+                        constexpr curve_element operator+(const curve_element &other) const {
+                            // handle special cases having to do with O
+                            if (this->is_zero()) {
+                                return other;
+                            }
+
+                            if (other.is_zero()) {
+                                return (*this);
+                            }
+
+                            if (*this == other) {
+                                return this->doubled();
+                            }
+
+                            return common_addition_processor::process(*this, other);
+                        }
+
+                        constexpr curve_element operator-() const {
+                            return curve_element(-S, C, D, Z);
+                        }
+
+                        constexpr curve_element operator-(const curve_element &other) const {
+                            return (*this) + (-other);
+                        }
+
+                        /** @brief
+                         *
+                         * @return doubled element from group G1
+                         */
+                        constexpr curve_element doubled() const {
+                            return common_doubling_processor::process(*this);
+                        }
+
+                        /** @brief
+                         *
+                         * “Mixed addition” refers to the case Z2 known to be 1.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element mixed_add(const curve_element &other) const {
+
+                            // handle special cases having to do with O
+                            if (this->is_zero()) {
+                                return other;
+                            }
+
+                            if (other.is_zero()) {
+                                return *this;
+                            }
+
+                            return mixed_addition_processor::process(*this, other);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_JACOBI_INTERSECTIONS_G1_ELEMENT_PROJECTIVE_HPP
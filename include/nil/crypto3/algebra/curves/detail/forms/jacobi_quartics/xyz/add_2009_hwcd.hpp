@@ -0,0 +1,73 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_JACOBI_QUARTICS_G1_ELEMENT_XYZ_ADD_2009_HWCD_HPP
+#define CRYPTO3_ALGEBRA_CURVES_JACOBI_QUARTICS_G1_ELEMENT_XYZ_ADD_2009_HWCD_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing element addition from the group G1 of extended Jacobi quartic curve
+                     *  for XYZ coordinates representation, where x=X/Z and y=Y/Z^2, following Hisil, Wong, Carter
+                     *  and Dawson, "Jacobi quartic curves revisited".
+                     *  The formulas are unified.
+                     */
+                    struct jacobi_quartics_element_g1_xyz_add_2009_hwcd {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first,
+                                                                    const ElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+                            using params_type = typename ElementType::params_type;
+
+                            field_value_type A = first.Z * second.Z;                // A = Z1*Z2
+                            field_value_type B = first.X * second.X;                // B = X1*X2
+                            field_value_type C = A.squared();                       // C = A^2
+                            field_value_type D = B.squared() * params_type::d;      // D = d*B^2
+                            field_value_type E = A * B;                             // E = A*B
+                            field_value_type F = first.X * second.Z;                // F = X1*Z2
+                            field_value_type G = second.X * first.Z;                // G = X2*Z1
+                            // H = Y1*Y2+2*a*E
+                            field_value_type H = first.Y * second.Y + (E * params_type::a).doubled();
+                            field_value_type I = (E * params_type::d).doubled();    // I = 2*d*E
+                            // X3 = X1*Z1*Y2+Y1*X2*Z2
+                            field_value_type X3 = first.X * first.Z * second.Y + first.Y * second.X * second.Z;
+                            // Y3 = H*(C+D)+I*(F^2+G^2)
+                            field_value_type Y3 = H * (C + D) + I * (F.squared() + G.squared());
+                            field_value_type Z3 = C - D;                            // Z3 = C-D
+
+                            return ElementType(X3, Y3, Z3);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_JACOBI_QUARTICS_G1_ELEMENT_XYZ_ADD_2009_HWCD_HPP
@@ -0,0 +1,66 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_JACOBI_QUARTICS_G1_ELEMENT_XYZ_DBL_2009_HWCD_HPP
+#define CRYPTO3_ALGEBRA_CURVES_JACOBI_QUARTICS_G1_ELEMENT_XYZ_DBL_2009_HWCD_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing element doubling from the group G1 of extended Jacobi quartic curve
+                     *  for XYZ coordinates representation.
+                     */
+                    struct jacobi_quartics_element_g1_xyz_dbl_2009_hwcd {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+                            using params_type = typename ElementType::params_type;
+
+                            field_value_type XX = first.X.squared();                          // XX = X1^2
+                            field_value_type ZZ = first.Z.squared();                          // ZZ = Z1^2
+                            field_value_type C = ZZ.squared();                                // C = ZZ^2
+                            field_value_type D = XX.squared() * params_type::d;               // D = d*XX^2
+                            field_value_type E = XX * ZZ;                                     // E = XX*ZZ
+                            // H = Y1^2+2*a*E
+                            field_value_type H = first.Y.squared() + (E * params_type::a).doubled();
+                            field_value_type X3 = (first.X * first.Y * first.Z).doubled();    // X3 = 2*X1*Y1*Z1
+                            // Y3 = H*(C+D)+4*d*E^2
+                            field_value_type Y3 = H * (C + D) + (E.squared() * params_type::d).doubled().doubled();
+                            field_value_type Z3 = C - D;                                      // Z3 = C-D
+
+                            return ElementType(X3, Y3, Z3);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_JACOBI_QUARTICS_G1_ELEMENT_XYZ_DBL_2009_HWCD_HPP
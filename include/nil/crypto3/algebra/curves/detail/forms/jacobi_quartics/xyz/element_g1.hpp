@@ -0,0 +1,223 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_JACOBI_QUARTICS_G1_ELEMENT_XYZ_HPP
+#define CRYPTO3_ALGEBRA_CURVES_JACOBI_QUARTICS_G1_ELEMENT_XYZ_HPP
+
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/inplace_arithmetic.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_quartics/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_quartics/xyz/add_2009_hwcd.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_quartics/xyz/dbl_2009_hwcd.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_quartics/xyz/madd_2009_hwcd.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing a group G1 of elliptic curve.
+                     *    @tparam CurveParams Parameters of the group
+                     *    @tparam Form Form of the curve
+                     *    @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    struct curve_element;
+
+                    /** @brief A struct representing an element from the group G1 of extended Jacobi quartic curve
+                     *  y^2 = d*x^4 + 2*a*x^2 + 1 of XYZ coordinates representation, where x = X/Z and y = Y/Z^2.
+                     *  Description: https://hyperelliptic.org/EFD/g1p/auto-jquartic.html
+                     *
+                     */
+                    template<typename CurveParams>
+                    struct curve_element<CurveParams, forms::jacobi_quartics, coordinates::xyz>
+                        : public inplace_arithmetic<curve_element<CurveParams, forms::jacobi_quartics, coordinates::xyz>> {
+
+                        using params_type = CurveParams;
+                        using field_type = typename params_type::field_type;
+
+                    private:
+                        using field_value_type = typename field_type::value_type;
+
+                        using common_addition_processor = jacobi_quartics_element_g1_xyz_add_2009_hwcd;
+                        using common_doubling_processor = jacobi_quartics_element_g1_xyz_dbl_2009_hwcd;
+                        using mixed_addition_processor = jacobi_quartics_element_g1_xyz_madd_2009_hwcd;
+
+                    public:
+                        using form = forms::jacobi_quartics;
+                        using coordinates = coordinates::xyz;
+
+                        using group_type = typename params_type::template group_type<coordinates>;
+
+                        field_value_type X;
+                        field_value_type Y;
+                        field_value_type Z;
+
+                        /*************************  Constructors and zero/one  ***********************************/
+
+                        /** @brief
+                         *    @return the point at infinity by default
+                         *
+                         */
+                        constexpr curve_element() :
+                            curve_element(field_value_type::zero(),
+                                          field_value_type::one(),
+                                          field_value_type::one()) {};
+
+                        /** @brief
+                         *    @return the selected point (X:Y:Z)
+                         *
+                         */
+                        constexpr curve_element(field_value_type X, field_value_type Y, field_value_type Z) {
+                            this->X = X;
+                            this->Y = Y;
+                            this->Z = Z;
+                        };
+
+                        /** @brief Get the point at infinity
+                         *
+                         */
+                        constexpr static curve_element zero() {
+                            return curve_element();
+                        }
+
+                        /** @brief Get the generator of group G1
+                         *
+                         */
+                        constexpr static curve_element one() {
+                            return curve_element(params_type::one_fill[0], params_type::one_fill[1],
+                                                 field_value_type::one());
+                        }
+
+                        /*************************  Comparison operations  ***********************************/
+
+                        constexpr bool operator==(const curve_element &other) const {
+                            // X1/Z1 = X2/Z2 and Y1/Z1^2 = Y2/Z2^2; the last check separates the two points with Z = 0
+                            return (this->X * other.Z) == (other.X * this->Z) &&
+                                   (this->Y * other.Z.squared()) == (other.Y * this->Z.squared()) &&
+                                   (this->X.squared() * other.Y) == (other.X.squared() * this->Y);
+                        }
+
+                        constexpr bool operator!=(const curve_element &other) const {
+                            return !(operator==(other));
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 is the point at infinity
+                         */
+                        constexpr bool is_zero() const {
+                            // the neutral element is (0:1:1)
+                            return this->X.is_zero() && this->Y == this->Z.squared();
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 lies on the elliptic curve
+                         *
+                         * A check, that Y^2 = d*X^4 + 2*a*X^2*Z^2 + Z^4
+                         */
+                        constexpr bool is_well_formed() const {
+                            field_value_type XX = this->X.squared();
+                            field_value_type ZZ = this->Z.squared();
+
+                            return !(this->X.is_zero() && this->Z.is_zero()) &&
+                                   this->Y.squared() == field_value_type(params_type::d) * XX.squared() +
+                                                            (field_value_type(params_type::a) * XX * ZZ).doubled() +
+                                                            ZZ.squared();
+                        }
+
+                        /*************************  Arithmetic operations  ***********************************/
+
+                        constexpr curve_element &operator=(const curve_element &other) {
+                            // handle special cases having to do with O
+                            this->X = other.X;
+                            this->Y = other.Y;
+                            this->Z = other.Z;
+
+                            return *this;
+                        }
+
+                        constexpr curve_element operator+(const curve_element &other) const {
+                            // handle special cases having to do with O
+                            if (this->is_zero()) {
+                                return other;
+                            }
+
+                            if (other.is_zero()) {
+                                return (*this);
+                            }
+
+                            if (*this == other) {
+                                return this->doubled();
+                            }
+
+                            return common_addition_processor::process(*this, other);
+                        }
+
+                        constexpr curve_element operator-() const {
+                            return curve_element(-X, Y, Z);
+                        }
+
+                        constexpr curve_element operator-(const curve_element &other) const {
+                            return (*this) + (-other);
+                        }
+
+                        /** @brief
+                         *
+                         * @return doubled element from group G1
+                         */
+                        constexpr curve_element doubled() const {
+                            return common_doubling_processor::process(*this);
+                        }
+
+                        /** @brief
+                         *
+                         * “Mixed addition” refers to the case Z2 known to be 1.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element mixed_add(const curve_element &other) const {
+
+                            // handle special cases having to do with O
+                            if (this->is_zero()) {
+                                return other;
+                            }
+
+                            if (other.is_zero()) {
+                                return *this;
+                            }
+
+                            return mixed_addition_processor::process(*this, other);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_JACOBI_QUARTICS_G1_ELEMENT_XYZ_HPP
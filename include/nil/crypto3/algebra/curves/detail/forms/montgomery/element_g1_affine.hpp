@@ -28,8 +28,10 @@
 #define CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_AFFINE_HPP
 
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/inplace_arithmetic.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/montgomery/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/element_g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
 
 namespace nil {
@@ -53,7 +55,8 @@ namespace nil {
                      *
                      */
                     template<typename CurveParams>
-                    struct curve_element<CurveParams, forms::montgomery, coordinates::affine> {
+                    struct curve_element<CurveParams, forms::montgomery, coordinates::affine>
+                        : public inplace_arithmetic<curve_element<CurveParams, forms::montgomery, coordinates::affine>> {
                         using field_type = typename CurveParams::field_type;
 
                     private:
@@ -156,21 +159,19 @@ namespace nil {
 
                         /*************************  Reducing operations  ***********************************/
 
-                        // /** @brief
-                        //  *
-                        //  * See https://eprint.iacr.org/2017/212.pdf, p. 7, par. 3.
-                        //  *
-                        //  * @return return the corresponding element from affine coordinates to
-                        //  xz coordinates
-                        //  */
-                        // constexpr curve_element<params_type, form, typename curves::coordinates::xz> to_xz() const {
-                        //     using result_type = curve_element<params_type, form, typename curves::coordinates::xz>;
-                        //
-                        //     return this->is_zero() ? result_type(result_type::field_type::value_type::one(),
-                        //                                          result_type::field_type::value_type::zero()) :
-                        //                              result_type(this->X,
-                        //                              result_type::field_type::value_type::one());
-                        // }
+                        /** @brief
+                         *
+                         * See https://eprint.iacr.org/2017/212.pdf, p. 7, par. 3.
+                         *
+                         * @return return the corresponding element from affine coordinates to
+                         * xz coordinates
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::xz> to_xz() const {
+                            using result_type = curve_element<params_type, form, typename curves::coordinates::xz>;
+
+                            return this->is_zero() ? result_type::zero() :
+                                                     result_type(this->X, result_type::field_type::value_type::one());
+                        }
 
                         /**
                          * @brief
@@ -184,7 +185,7 @@ namespace nil {
 
                         /*************************  Arithmetic operations  ***********************************/
 
-                        constexpr curve_element operator=(const curve_element &other) {
+                        constexpr curve_element &operator=(const curve_element &other) {
                             this->is_inf_point = other.is_inf_point;
 
                             if (!other.is_zero()) {
@@ -204,8 +205,8 @@ namespace nil {
                                 return (*this);
                             }
 
-                            if (*this == other) {
-                                return this->doubled();
+                            if (this->X == other.X) {
+                                return this->Y == other.Y ? this->doubled() : zero();
                             }
 
                             return this->add(other);
@@ -227,58 +228,86 @@ namespace nil {
                         /**
                          * @brief Affine doubling formulas: 2(x1,y1)=(x3,y3) where
                          *
-                         * x3 = b*(3*x1^2+2*a*x1+1)^2/(2*b*y1)^2-a-x1-x1
-                         * y3 = (2*x1+x1+a)*(3*x1^2+2*a*x1+1)/(2*b*y1)-b*(3*x1^2+2*a*x1+1)^3/(2*b*y1)^3-y1
+                         * l = (3*x1^2+2*a*x1+1)/(2*b*y1)
+                         * x3 = b*l^2-a-x1-x1
+                         * y3 = l*(x1-x3)-y1
                          *
                          * See https://hyperelliptic.org/EFD/g1p/auto-montgom.html
                          *
                          * @return doubled element from group G1
                          */
                         constexpr curve_element doubled() const {
-                            if (this->is_zero()) {
-                                return (*this);
+                            if (this->is_zero() || this->Y.is_zero()) {
+                                return zero();
                             } else {
-                                const field_value_type two(2);
-                                const field_value_type three(3);
-                                const field_value_type A(params_type::A);
-                                const field_value_type B(params_type::B);
-
-                                const field_value_type temp1 = two * B * this->Y;
-                                const field_value_type temp2 =
-                                    three * this->X.squared() + two * A * this->X + field_value_type::one();
-                                const field_value_type temp1_sqr = temp1.squared();
-                                const field_value_type temp2_sqr = temp2.squared();
-
-                                return curve_element((B * temp2_sqr) / temp1_sqr - A - this->X - this->X,
-                                                     ((three * this->X + A) * temp2) / temp1 -
-                                                         (B * temp2 * temp2_sqr) / (temp1 * temp1_sqr) - this->Y);
+                                return this->doubled_with_inverse(this->doubling_denominator().inversed());
                             }
                         }
 
+                        /**
+                         * @brief
+                         *
+                         * @return the field element doubled() divides by, 2*b*y1
+                         */
+                        constexpr field_value_type doubling_denominator() const {
+                            return (field_value_type(params_type::B) * this->Y).doubled();
+                        }
+
+                        /**
+                         * @brief Finishes doubled() of a point with y1 != 0 given the inverse of
+                         * doubling_denominator(), so that many doublings can share one inversion, see
+                         * batch_affine_double().
+                         */
+                        constexpr curve_element doubled_with_inverse(const field_value_type &inverse) const {
+                            const field_value_type A(params_type::A);
+                            const field_value_type B(params_type::B);
+
+                            const field_value_type XX = this->X.squared();
+                            const field_value_type lambda =
+                                (XX.doubled() + XX + (A * this->X).doubled() + field_value_type::one()) * inverse;
+                            const field_value_type X3 = B * lambda.squared() - A - this->X.doubled();
+
+                            return curve_element(X3, lambda * (this->X - X3) - this->Y);
+                        }
+
+                        /**
+                         * @brief
+                         *
+                         * @return the field element the addition of other divides by, x2-x1
+                         */
+                        constexpr field_value_type addition_denominator(const curve_element &other) const {
+                            return other.X - this->X;
+                        }
+
+                        /**
+                         * @brief Finishes the addition of other, x2 != x1, given the inverse of
+                         * addition_denominator(other), see batch_affine_add().
+                         */
+                        constexpr curve_element add_with_inverse(const curve_element &other,
+                                                                 const field_value_type &inverse) const {
+                            const field_value_type A(params_type::A);
+                            const field_value_type B(params_type::B);
+
+                            const field_value_type lambda = (other.Y - this->Y) * inverse;
+                            const field_value_type X3 = B * lambda.squared() - A - this->X - other.X;
+
+                            return curve_element(X3, lambda * (this->X - X3) - this->Y);
+                        }
+
                     private:
                         /**
                          * @brief Affine addition formulas: (x1,y1)+(x2,y2)=(x3,y3) where
                          *
-                         * x3 = b*(y2-y1)^2/(x2-x1)^2-a-x1-x2
-                         * y3 = (2*x1+x2+a)*(y2-y1)/(x2-x1)-b*(y2-y1)^3/(x2-x1)^3-y1
+                         * l = (y2-y1)/(x2-x1)
+                         * x3 = b*l^2-a-x1-x2
+                         * y3 = l*(x1-x3)-y1
                          *
                          * See https://hyperelliptic.org/EFD/g1p/auto-montgom.html
                          *
                          * @return addition of two elements from group G1
                          */
                         constexpr curve_element add(const curve_element &other) const {
-                            const field_value_type two(2);
-                            const field_value_type A(params_type::A);
-                            const field_value_type B(params_type::B);
-
-                            const field_value_type temp1 = (other.Y) - (this->Y);
-                            const field_value_type temp2 = (other.X) - (this->X);
-                            const field_value_type temp1_sqr = temp1.squared();
-                            const field_value_type temp2_sqr = temp2.squared();
-
-                            return curve_element((B * temp1_sqr) / temp2_sqr - A - this->X - other.X,
-                                                 ((two * this->X + other.X + A) * temp1) / temp2 -
-                                                     (B * temp1 * temp1_sqr) / (temp2 * temp2_sqr) - this->Y);
+                            return this->add_with_inverse(other, this->addition_denominator(other).inversed());
                         }
 
                     public:
@@ -0,0 +1,65 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_DADD_1987_M_3_HPP
+#define CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_DADD_1987_M_3_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing differential addition from the group G1 of Montgomery curve
+                     *  for XZ coordinates representation: given P, Q and P-Q returns P+Q.
+                     *  https://hyperelliptic.org/EFD/g1p/auto-montgom-xz.html#diffadd-dadd-1987-m-3
+                     */
+                    struct montgomery_element_g1_xz_dadd_1987_m_3 {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first,
+                                                                    const ElementType &second,
+                                                                    const ElementType &difference) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type A = first.X + first.Z;                      // A = X2+Z2
+                            field_value_type B = first.X - first.Z;                      // B = X2-Z2
+                            field_value_type C = second.X + second.Z;                    // C = X3+Z3
+                            field_value_type D = second.X - second.Z;                    // D = X3-Z3
+                            field_value_type DA = D * A;                                 // DA = D*A
+                            field_value_type CB = C * B;                                 // CB = C*B
+                            field_value_type X5 = difference.Z * (DA + CB).squared();    // X5 = Z1*(DA+CB)^2
+                            field_value_type Z5 = difference.X * (DA - CB).squared();    // Z5 = X1*(DA-CB)^2
+
+                            return ElementType(X5, Z5);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_DADD_1987_M_3_HPP
@@ -0,0 +1,250 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
+#define CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/inplace_arithmetic.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/dbl_1987_m_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/dadd_1987_m_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/ladder.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief A struct representing a group G1 of elliptic curve.
+                     *    @tparam CurveParams Parameters of the group
+                     *    @tparam Form Form of the curve
+                     *    @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    struct curve_element;
+
+                    /** @brief A struct representing an element from the group G1 of Montgomery curve of
+                     *  XZ coordinates representation: x = X/Z, the y-coordinate is dropped.
+                     *
+                     *  An element and its negation share the same representation, so only doubling and
+                     *  differential addition are available; scalar multiplication uses the Montgomery ladder.
+                     *  Description: https://hyperelliptic.org/EFD/g1p/auto-montgom-xz.html
+                     *
+                     */
+                    template<typename CurveParams>
+                    struct curve_element<CurveParams, forms::montgomery, coordinates::xz>
+                        : public inplace_arithmetic<curve_element<CurveParams, forms::montgomery, coordinates::xz>> {
+
+                        using field_type = typename CurveParams::field_type;
+
+                    private:
+                        using field_value_type = typename field_type::value_type;
+
+                        using dbl_processor = montgomery_element_g1_xz_dbl_1987_m_3;
+                        using dadd_processor = montgomery_element_g1_xz_dadd_1987_m_3;
+
+                    public:
+                        using params_type = CurveParams;
+                        using form = forms::montgomery;
+                        using coordinates = coordinates::xz;
+
+                        using group_type = typename params_type::template group_type<coordinates>;
+
+                        field_value_type X;
+                        field_value_type Z;
+
+                        /*************************  Constructors and zero/one  ***********************************/
+
+                        /**
+                         * @brief
+                         *    @return the point at infinity by default
+                         *
+                         */
+                        constexpr curve_element() :
+                            curve_element(field_value_type::one(), field_value_type::zero()) {};
+
+                        /**
+                         * @brief
+                         *    @return the selected point $(X:Z)$ in the XZ coordinates
+                         *
+                         */
+                        constexpr curve_element(const field_value_type &in_X, const field_value_type &in_Z) :
+                            X(in_X), Z(in_Z) {};
+
+                        /**
+                         * @brief Get the point at infinity
+                         *
+                         */
+                        constexpr static curve_element zero() {
+                            return curve_element();
+                        }
+
+                        /**
+                         * @brief Get the generator of group G1
+                         *
+                         */
+                        constexpr static curve_element one() {
+                            return curve_element(params_type::one_fill[0], field_value_type::one());
+                        }
+
+                        /**
+                         * @brief Montgomery constant (A+2)/4 used by the doubling formula.
+                         *
+                         */
+                        static const field_value_type &a24() {
+                            static const field_value_type value =
+                                (field_value_type(params_type::A) + field_value_type(2)) *
+                                field_value_type(4).inversed();
+                            return value;
+                        }
+
+                        /*************************  Comparison operations  ***********************************/
+
+                        constexpr bool operator==(const curve_element &other) const {
+                            if (this->is_zero()) {
+                                return other.is_zero();
+                            }
+
+                            if (other.is_zero()) {
+                                return false;
+                            }
+
+                            /* now neither is O */
+
+                            return (this->X * other.Z) == (other.X * this->Z);
+                        }
+
+                        constexpr bool operator!=(const curve_element &other) const {
+                            return !(operator==(other));
+                        }
+
+                        /**
+                         * @brief
+                         *
+                         * @return true if element from group G1 is the point at infinity
+                         */
+                        constexpr bool is_zero() const {
+                            return this->Z.is_zero();
+                        }
+
+                        /**
+                         * @brief Check that x = X/Z is the abscissa of a point of the curve b*y^2 = x^3 + a*x^2 + x
+                         * rather than of its quadratic twist, i.e. that Z*(X^3 + a*X^2*Z + X*Z^2)/b is a square
+                         *
+                         * @return true if element from group G1 lies on the elliptic curve
+                         */
+                        constexpr bool is_well_formed() const {
+                            if (this->is_zero()) {
+                                return true;
+                            }
+
+                            const field_value_type XX = this->X.squared();
+                            const field_value_type rhs =
+                                this->Z * this->X * (XX + field_value_type(params_type::A) * this->X * this->Z +
+                                                     this->Z.squared());
+
+                            return (rhs * field_value_type(params_type::B).inversed()).is_square();
+                        }
+
+                        /*************************  Reducing operations  ***********************************/
+
+                        /**
+                         * @brief
+                         *
+                         * @return the affine x-coordinate X/Z of a non-zero element
+                         */
+                        constexpr field_value_type to_affine_x() const {
+                            return this->X * this->Z.inversed();
+                        }
+
+                        /*************************  Arithmetic operations  ***********************************/
+
+                        /**
+                         * @brief Doubling of an element, independent of y.
+                         *
+                         * @return doubled element from group G1
+                         */
+                        constexpr curve_element doubled() const {
+                            return dbl_processor::process(*this);
+                        }
+
+                        /**
+                         * @brief Differential addition: computes P+Q from P = *this, Q = other and
+                         * the difference P-Q, which must not be zero.
+                         *
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element differential_add(const curve_element &other,
+                                                                 const curve_element &difference) const {
+                            return dadd_processor::process(*this, other, difference);
+                        }
+                    };
+
+                    template<typename CurveParams,
+                             typename Backend,
+                             multiprecision::expression_template_option ExpressionTemplates>
+                    curve_element<CurveParams, forms::montgomery, coordinates::xz>
+                        operator*(const curve_element<CurveParams, forms::montgomery, coordinates::xz> &left,
+                                  const multiprecision::number<Backend, ExpressionTemplates> &right) {
+
+                        return montgomery_ladder(left, right);
+                    }
+
+                    template<typename CurveParams,
+                             typename Backend,
+                             typename SafeType,
+                             multiprecision::expression_template_option ExpressionTemplates>
+                    curve_element<CurveParams, forms::montgomery, coordinates::xz>
+                        operator*(const curve_element<CurveParams, forms::montgomery, coordinates::xz> &left,
+                                  const multiprecision::number<
+                                      multiprecision::backends::modular_adaptor<Backend, SafeType>,
+                                      ExpressionTemplates> &right) {
+
+                        return montgomery_ladder(
+                            left,
+                            right.template convert_to<multiprecision::number<Backend, ExpressionTemplates>>());
+                    }
+
+                    template<typename CurveParams,
+                             typename Backend,
+                             multiprecision::expression_template_option ExpressionTemplates>
+                    curve_element<CurveParams, forms::montgomery, coordinates::xz>
+                        operator*(const multiprecision::number<Backend, ExpressionTemplates> &left,
+                                  const curve_element<CurveParams, forms::montgomery, coordinates::xz> &right) {
+
+                        return montgomery_ladder(right, left);
+                    }
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_LADDER_HPP
+#define CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_LADDER_HPP
+
+#include <algorithm>
+#include <cstdint>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /**
+                     * @brief Swaps a and b iff bit is one, using the same field operations for both values of bit.
+                     */
+                    template<typename FieldValueType>
+                    constexpr inline void montgomery_ladder_cswap(FieldValueType &a, FieldValueType &b,
+                                                                  const FieldValueType &bit) {
+                        FieldValueType t = bit * (a - b);
+                        a -= t;
+                        b += t;
+                    }
+
+                    /**
+                     * @brief x-only scalar multiplication of XZ point by Montgomery ladder.
+                     *
+                     * Every step performs one differential addition, one doubling and one conditional swap
+                     * regardless of the scalar bit, and the number of steps depends only on the bit length of
+                     * the base field (or of the scalar, if it is longer), so the sequence of field operations does
+                     * not depend on the scalar. Swaps are deferred as in RFC 7748, section 5.
+                     *
+                     * See https://datatracker.ietf.org/doc/html/rfc7748#section-5
+                     */
+                    template<typename ElementType,
+                             typename Backend,
+                             multiprecision::expression_template_option ExpressionTemplates>
+                    ElementType montgomery_ladder(const ElementType &base,
+                                                  const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                        using field_value_type = typename ElementType::field_type::value_type;
+
+                        if (base.is_zero()) {
+                            return base;
+                        }
+
+                        std::size_t bits = ElementType::field_type::modulus_bits;
+                        if (!scalar.is_zero()) {
+                            bits = std::max<std::size_t>(bits, multiprecision::msb(scalar) + 1);
+                        }
+
+                        ElementType R0 = ElementType::zero(), R1 = base;
+                        std::size_t swap = 0;
+
+                        for (auto i = static_cast<std::int64_t>(bits) - 1; i >= 0; --i) {
+                            const std::size_t bit = multiprecision::bit_test(scalar, i);
+                            const field_value_type s(swap ^ bit);
+                            montgomery_ladder_cswap(R0.X, R1.X, s);
+                            montgomery_ladder_cswap(R0.Z, R1.Z, s);
+                            swap = bit;
+
+                            R1 = R0.differential_add(R1, base);
+                            R0.double_inplace();
+                        }
+                        const field_value_type s(swap);
+                        montgomery_ladder_cswap(R0.X, R1.X, s);
+                        montgomery_ladder_cswap(R0.Z, R1.Z, s);
+
+                        return R0;
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_LADDER_HPP
@@ -43,6 +43,7 @@ namespace nil {
                     struct jacobian_with_a4_minus_3;
                     struct modified_jacobian;
                     struct projective;
+                    struct projective_with_a4_0;
                     struct projective_with_a4_minus_1;
                     struct projective_with_a4_minus_3;
                     struct w12_with_a6_0;
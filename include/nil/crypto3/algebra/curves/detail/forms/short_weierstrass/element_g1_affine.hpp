@@ -27,10 +27,19 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_HPP
 
+#include <array>
+
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/inplace_arithmetic.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
 
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_hessian/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/hessian/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_quartics/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/jacobi_intersections/coordinates.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -51,7 +60,8 @@ namespace nil {
                      *
                      */
                     template<typename CurveParams>
-                    struct curve_element<CurveParams, forms::short_weierstrass, coordinates::affine> {
+                    struct curve_element<CurveParams, forms::short_weierstrass, coordinates::affine>
+                        : public inplace_arithmetic<curve_element<CurveParams, forms::short_weierstrass, coordinates::affine>> {
 
                         using field_type = typename CurveParams::field_type;
 
@@ -71,11 +81,11 @@ namespace nil {
                         /*************************  Constructors and zero/one  ***********************************/
 
                         /** @brief
-                         *    @return the point at infinity by default
+                         *    @return the point at infinity by default, represented by $(0:0)$
                          *
                          */
                         constexpr curve_element() :
-                            curve_element(params_type::zero_fill[0], params_type::zero_fill[1]) {};
+                            curve_element(field_value_type::zero(), field_value_type::zero()) {};
 
                         /** @brief
                          *    @return the selected point $(X:Y)$ in the affine coordinates
@@ -133,7 +143,7 @@ namespace nil {
                          * @return true if element from group G1 is the point at infinity
                          */
                         constexpr bool is_zero() const {
-                            return X == params_type::zero_fill[0] && Y == params_type::zero_fill[0];
+                            return X.is_zero() && Y.is_zero();
                         }
 
                         /*************************  Reducing operations  ***********************************/
@@ -149,13 +159,165 @@ namespace nil {
                             using result_type =
                                 curve_element<params_type, form, typename curves::coordinates::projective>;
 
+                            if (this->is_zero()) {
+                                return result_type::zero();
+                            }
+
                             return result_type(X, Y,
                                                result_type::field_type::value_type::one());    // X = x, Y = y, Z = 1
                         }
 
+                        /**
+                         * @brief Convert point coordinates into twisted Hessian form a*X^3 + Y^3 + Z^3 = d*X*Y*Z
+                         * according to the birational equivalence of Bernstein, Chuengsatiansup, Kohel and Lange,
+                         * "Twisted Hessian curves".
+                         *
+                         * Moving a point (x0, y0) of order 3 to the origin by
+                         *   x = x' + x0, y = y' + y0 + l * x', where l = (3 * x0^2 + a) / (2 * y0)
+                         * gives y'^2 + a1 * x' * y' + a3 * y' = x'^3 with a1 = 2 * l and a3 = 2 * y0, which is
+                         * equivalent to the twisted Hessian curve with a = a1^3 - 27 * a3 and d = 3 * a1. Sending the
+                         * flex tangents at the neutral element (0:-1:1) and at the points (0:-w:1), (0:-w^2:1) of order
+                         * 3 to z = 0, y = 0 and y + a1 * x + a3 = 0 gives
+                         *   X = 3 * (w^2 - 1) * x'
+                         *   Y = 9 * a3 - 9 * w * y' - d * (w - 1) * x'
+                         *   Z = (1 - w^2) * (9 * a3 + d * x') - Y
+                         * where w is the primitive cube root of unity omega of the target parameters. The point
+                         * (x0, y0) is recovered from a and d.
+                         *
+                         * @return point in projective coordinates of twisted Hessian form
+                         */
+                        constexpr auto to_twisted_hessian() const {
+                            using result_params =
+                                typename group_type::curve_type::template g1_type<curves::coordinates::projective,
+                                                                                  forms::twisted_hessian>::params_type;
+                            using result_type =
+                                typename group_type::curve_type::template g1_type<curves::coordinates::projective,
+                                                                                  forms::twisted_hessian>::value_type;
+
+                            if (this->is_zero()) {
+                                return result_type();
+                            }
+
+                            std::array<field_value_type, 3> XYZ =
+                                twisted_hessian_coordinates(static_cast<field_value_type>(result_params::a),
+                                                            static_cast<field_value_type>(result_params::d),
+                                                            static_cast<field_value_type>(result_params::omega));
+
+                            return result_type(XYZ[0], XYZ[1], XYZ[2]);
+                        }
+
+                        /**
+                         * @brief Convert point coordinates into Hessian form X^3 + Y^3 + Z^3 = 3*d*X*Y*Z.
+                         *
+                         * The Hessian curve is the twisted Hessian curve with a = alpha^3 and d' = 3 * d * alpha
+                         * after scaling X by alpha, with the coordinates permuted so that the neutral element becomes
+                         * (1:-1:0). See to_twisted_hessian() for the map itself.
+                         *
+                         * @return point in projective coordinates of Hessian form
+                         */
+                        constexpr auto to_hessian() const {
+                            using result_params =
+                                typename group_type::curve_type::template g1_type<curves::coordinates::projective,
+                                                                                  forms::hessian>::params_type;
+                            using result_type =
+                                typename group_type::curve_type::template g1_type<curves::coordinates::projective,
+                                                                                  forms::hessian>::value_type;
+
+                            if (this->is_zero()) {
+                                return result_type();
+                            }
+
+                            field_value_type alpha = static_cast<field_value_type>(result_params::alpha);
+                            field_value_type d = static_cast<field_value_type>(result_params::d);
+
+                            std::array<field_value_type, 3> XYZ =
+                                twisted_hessian_coordinates(alpha.squared() * alpha,
+                                                            static_cast<field_value_type>(3) * d * alpha,
+                                                            static_cast<field_value_type>(result_params::omega));
+
+                            return result_type(XYZ[2], XYZ[1], alpha * XYZ[0]);
+                        }
+
+                        /**
+                         * @brief Convert point coordinates into extended Jacobi quartic form y^2 = d*x^4 + 2*a*x^2 + 1
+                         * according to the birational equivalence of Billet and Joye.
+                         *
+                         * With t = x - theta for a point (theta, 0) of order 2 the curve reads
+                         * y^2 = t * (t^2 + 3 * theta * t + q), q = 3 * theta^2 + a, and
+                         *   (t, y) --> (t / y, t * (t^2 - q) / y^2)
+                         * maps it onto the quartic with a' = -3 * theta and d' = -3 * theta^2 - 4 * a;
+                         * (theta, 0) goes to (0, -1). The root theta is recovered from a'.
+                         *
+                         * @return point in XYZ coordinates of Jacobi quartic form
+                         */
+                        constexpr auto to_jacobi_quartic() const {
+                            using result_params =
+                                typename group_type::curve_type::template g1_type<curves::coordinates::xyz,
+                                                                                  forms::jacobi_quartics>::params_type;
+                            using result_type =
+                                typename group_type::curve_type::template g1_type<curves::coordinates::xyz,
+                                                                                  forms::jacobi_quartics>::value_type;
+
+                            if (this->is_zero()) {
+                                return result_type();
+                            }
+
+                            field_value_type theta = -static_cast<field_value_type>(result_params::a) *
+                                                     static_cast<field_value_type>(3).inversed();
+
+                            BOOST_ASSERT(static_cast<field_value_type>(result_params::d) ==
+                                         -static_cast<field_value_type>(3) * theta.squared() -
+                                             static_cast<field_value_type>(4) *
+                                                 static_cast<field_value_type>(params_type::a));
+
+                            std::array<field_value_type, 3> XYZ = jacobi_quartic_coordinates(theta);
+
+                            return result_type(XYZ[0], XYZ[1], XYZ[2]);
+                        }
+
+                        /**
+                         * @brief Convert point coordinates into Jacobi intersection form s^2 + c^2 = 1,
+                         * a*s^2 + d^2 = 1.
+                         *
+                         * The Jacobi quartic y^2 = x^4 + 2*a'*x^2 + 1 is mapped onto the intersection with
+                         * a = (1 - a') / 2 by
+                         *   (x, y) --> (2 * x / (1 + x^2), (1 - x^2) / (1 + x^2), y / (1 + x^2))
+                         * The quartic of to_jacobi_quartic() has d' = mu^4 and is brought to d' = 1 by scaling x by mu,
+                         * the parameter mu of the target.
+                         *
+                         * @return point in projective coordinates of Jacobi intersection form
+                         */
+                        constexpr auto to_jacobi_intersection() const {
+                            using result_params = typename group_type::curve_type::template g1_type<
+                                curves::coordinates::projective, forms::jacobi_intersections>::params_type;
+                            using result_type = typename group_type::curve_type::template g1_type<
+                                curves::coordinates::projective, forms::jacobi_intersections>::value_type;
+
+                            if (this->is_zero()) {
+                                return result_type();
+                            }
+
+                            field_value_type mu = static_cast<field_value_type>(result_params::mu);
+                            field_value_type mu2 = mu.squared();
+                            field_value_type theta = -mu2 *
+                                                     (field_value_type::one() -
+                                                      static_cast<field_value_type>(result_params::a).doubled()) *
+                                                     static_cast<field_value_type>(3).inversed();
+
+                            BOOST_ASSERT(mu2.squared() == -static_cast<field_value_type>(3) * theta.squared() -
+                                                              static_cast<field_value_type>(4) *
+                                                                  static_cast<field_value_type>(params_type::a));
+
+                            std::array<field_value_type, 3> XYZ = jacobi_quartic_coordinates(theta);
+                            field_value_type ZZ = XYZ[2].squared();
+                            field_value_type m = mu2 * XYZ[0].squared();
+
+                            return result_type((mu * XYZ[0] * XYZ[2]).doubled(), ZZ - m, XYZ[1], ZZ + m);
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
-                        constexpr curve_element operator=(const curve_element &other) {
+                        constexpr curve_element &operator=(const curve_element &other) {
                             // handle special cases having to do with O
                             this->X = other.X;
                             this->Y = other.Y;
@@ -173,8 +335,8 @@ namespace nil {
                                 return (*this);
                             }
 
-                            if (*this == other) {
-                                return this->doubled();
+                            if (this->X == other.X) {
+                                return this->Y == other.Y ? this->doubled() : zero();
                             }
 
                             return this->add(other);
@@ -190,43 +352,122 @@ namespace nil {
 
                         /** @brief
                          * Affine doubling formulas: 2(x1,y1)=(x3,y3) where
-                         * x3 = (3*x12+a)2/(2*y1)2-x1-x1
-                         * y3 = (2*x1+x1)*(3*x12+a)/(2*y1)-(3*x12+a)3/(2*y1)3-y1
+                         * l = (3*x1^2+a)/(2*y1)
+                         * x3 = l^2-x1-x1
+                         * y3 = l*(x1-x3)-y1
                          * @return doubled element from group G1
                          */
                         constexpr curve_element doubled() const {
-
-                            if (this->is_zero()) {
-                                return (*this);
-                            } else {
-                                field_value_type Xsquared = X.squared();
-                                field_value_type Xsquared3pa = Xsquared.doubled() + Xsquared + params_type::a;
-                                field_value_type Xsquared3pasquared = Xsquared3pa.squared();
-                                field_value_type Y2squared = Y.doubled().squared();
-
-                                field_value_type X3 = Xsquared3pasquared * Y2squared.inversed() - X - X;
-                                field_value_type Y3 = (X.doubled() + X) * Xsquared3pa * Y.doubled().inversed() -
-                                                      Xsquared3pasquared * Xsquared3pa * Y2squared * (Y.doubled()) - Y;
+                            if (this->is_zero() || this->Y.is_zero()) {
+                                return zero();
                             }
+
+                            return this->doubled_with_inverse(this->doubling_denominator().inversed());
+                        }
+
+                        /** @brief
+                         *
+                         * @return the field element doubled() divides by, 2*y1
+                         */
+                        constexpr field_value_type doubling_denominator() const {
+                            return Y.doubled();
+                        }
+
+                        /** @brief
+                         *
+                         * Finishes doubled() of a point with y1 != 0 given the inverse of doubling_denominator(),
+                         * so that many doublings can share one inversion, see batch_affine_double().
+                         */
+                        constexpr curve_element doubled_with_inverse(const field_value_type &inverse) const {
+                            field_value_type Xsquared = X.squared();
+                            field_value_type lambda = (Xsquared.doubled() + Xsquared + params_type::a) * inverse;
+                            field_value_type X3 = lambda.squared() - X.doubled();
+
+                            return curve_element(X3, lambda * (X - X3) - Y);
+                        }
+
+                        /** @brief
+                         *
+                         * @return the field element the addition of other divides by, x2-x1
+                         */
+                        constexpr field_value_type addition_denominator(const curve_element &other) const {
+                            return other.X - X;
+                        }
+
+                        /** @brief
+                         *
+                         * Finishes the addition of other, x2 != x1, given the inverse of addition_denominator(other),
+                         * see batch_affine_add().
+                         */
+                        constexpr curve_element add_with_inverse(const curve_element &other,
+                                                                 const field_value_type &inverse) const {
+                            field_value_type lambda = (other.Y - Y) * inverse;
+                            field_value_type X3 = lambda.squared() - X - other.X;
+
+                            return curve_element(X3, lambda * (X - X3) - Y);
                         }
 
                     private:
                         /** @brief
                          * Affine addition formulas: (x1,y1)+(x2,y2)=(x3,y3) where
-                         * x3 = (y2-y1)2/(x2-x1)2-x1-x2
-                         * y3 = (2*x1+x2)*(y2-y1)/(x2-x1)-(y2-y1)3/(x2-x1)3-y1
+                         * l = (y2-y1)/(x2-x1)
+                         * x3 = l^2-x1-x2
+                         * y3 = l*(x1-x3)-y1
                          */
                         curve_element add(const curve_element &other) const {
-                            field_value_type Y2mY1 = other.Y - this->Y;
-                            field_value_type Y2mY1squared = Y2mY1.squared();
-                            field_value_type X2mX1 = other.X - this->X;
-                            field_value_type X2mX1squared = X2mX1.squared();
+                            return this->add_with_inverse(other, this->addition_denominator(other).inversed());
+                        }
+
+                        /** @brief
+                         * Projective twisted Hessian coordinates of a finite point, see to_twisted_hessian().
+                         */
+                        std::array<field_value_type, 3>
+                            twisted_hessian_coordinates(const field_value_type &a, const field_value_type &d,
+                                                        const field_value_type &omega) const {
+                            field_value_type a1 = d * static_cast<field_value_type>(3).inversed();
+                            field_value_type a3 =
+                                (a1.squared() * a1 - a) * static_cast<field_value_type>(27).inversed();
+                            field_value_type l = a1 * static_cast<field_value_type>(2).inversed();
+                            field_value_type x0 = l.squared() * static_cast<field_value_type>(3).inversed();
+                            field_value_type y0 = a3 * static_cast<field_value_type>(2).inversed();
+
+                            // (x0, y0) is a point of order 3 of this curve
+                            BOOST_ASSERT(y0.squared() == x0.squared() * x0 +
+                                                             static_cast<field_value_type>(params_type::a) * x0 +
+                                                             static_cast<field_value_type>(params_type::b));
+
+                            field_value_type x = this->X - x0;
+                            field_value_type y = this->Y - y0 - l * x;
+                            field_value_type omega2 = omega.squared();
+                            field_value_type a3_9 = static_cast<field_value_type>(9) * a3;
+                            field_value_type Y3 = a3_9 - static_cast<field_value_type>(9) * omega * y -
+                                                  d * (omega - field_value_type::one()) * x;
+
+                            return {static_cast<field_value_type>(3) * (omega2 - field_value_type::one()) * x, Y3,
+                                    (field_value_type::one() - omega2) * (a3_9 + d * x) - Y3};
+                        }
+
+                        /** @brief
+                         * Weighted XYZ Jacobi quartic coordinates for the root theta, see to_jacobi_quartic().
+                         */
+                        std::array<field_value_type, 3>
+                            jacobi_quartic_coordinates(const field_value_type &theta) const {
+                            // (theta, 0) is a point of order 2 of this curve
+                            BOOST_ASSERT(theta.squared() * theta +
+                                             static_cast<field_value_type>(params_type::a) * theta +
+                                             static_cast<field_value_type>(params_type::b) ==
+                                         field_value_type::zero());
+
+                            field_value_type t = this->X - theta;
+
+                            if (t.is_zero()) {
+                                return {field_value_type::zero(), -field_value_type::one(), field_value_type::one()};
+                            }
 
-                            field_value_type X3 = Y2mY1squared * X2mX1squared.inversed() - this->X - other.X;
-                            field_value_type Y3 = ((this - X).doubled() + other.X) * Y2mY1 * X2mX1.inversed() -
-                                                  Y2mY1 * Y2mY1squared * (X2mX1 * X2mX1squared).inversed() - this->Y;
+                            field_value_type q = static_cast<field_value_type>(3) * theta.squared() +
+                                                 static_cast<field_value_type>(params_type::a);
 
-                            return curve_element(X3, Y3);
+                            return {t, t * (t.squared() - q), this->Y};
                         }
                     };
 
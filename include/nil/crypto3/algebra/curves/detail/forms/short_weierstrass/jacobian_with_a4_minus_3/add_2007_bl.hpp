@@ -36,35 +36,33 @@ namespace nil {
                      *  for jacobian_with_a4_minus_3 coordinates representation.
                      *  NOTE: does not handle O and pts of order 2,4
                      *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html#addition-add-2007-bl
+                     *  The result is written into the coordinates of first.
                      */
 
                     struct short_weierstrass_element_g1_jacobian_with_a4_minus_3_add_2007_bl {
 
                         template<typename ElementType>
-                        constexpr static inline ElementType process(const ElementType &first,
-                                                                    const ElementType &second) {
+                        constexpr static inline void process_inplace(ElementType &first, const ElementType &second) {
 
                             using field_value_type = typename ElementType::field_type::value_type;
 
-                            field_value_type Z1Z1 = (first.Z).squared();            // Z1Z1 = Z1^2
-                            field_value_type Z2Z2 = (second.Z).squared();           // Z2Z2 = Z2^2
-                            field_value_type U1 = (first.X) * Z2Z2;                 // U1 = X1 * Z2Z2
-                            field_value_type U2 = (second.X) * Z1Z1;                // U2 = X2 * Z1Z1
-                            field_value_type S1 = (first.Y) * (second.Z) * Z2Z2;    // S1 = Y1 * Z2 * Z2Z2
-                            field_value_type S2 = (second.Y) * (first.Z) * Z1Z1;    // S2 = Y2 * Z1 * Z1Z1
-                            field_value_type H = U2 - U1;                           // H = U2-U1
-                            field_value_type S2_minus_S1 = S2 - S1;
-                            field_value_type I = (H + H).squared();             // I = (2 * H)^2
-                            field_value_type J = H * I;                         // J = H * I
-                            field_value_type r = S2_minus_S1 + S2_minus_S1;     // r = 2 * (S2-S1)
-                            field_value_type V = U1 * I;                        // V = U1 * I
-                            field_value_type X3 = r.squared() - J - (V + V);    // X3 = r^2 - J - 2 * V
-                            field_value_type S1_J = S1 * J;
-                            field_value_type Y3 = r * (V - X3) - (S1_J + S1_J);    // Y3 = r * (V-X3)-2 S1 J
-                            field_value_type Z3 =
-                                ((first.Z + second.Z).squared() - Z1Z1 - Z2Z2) * H;    // Z3 = ((Z1+Z2)^2-Z1Z1-Z2Z2) * H
+                            const field_value_type Z1Z1 = (first.Z).squared();            // Z1Z1 = Z1^2
+                            const field_value_type Z2Z2 = (second.Z).squared();           // Z2Z2 = Z2^2
+                            const field_value_type U1 = (first.X) * Z2Z2;                 // U1 = X1 * Z2Z2
+                            const field_value_type U2 = (second.X) * Z1Z1;                // U2 = X2 * Z1Z1
+                            const field_value_type S1 = (first.Y) * (second.Z) * Z2Z2;    // S1 = Y1 * Z2 * Z2Z2
+                            const field_value_type S2 = (second.Y) * (first.Z) * Z1Z1;    // S2 = Y2 * Z1 * Z1Z1
+                            const field_value_type H = U2 - U1;                           // H = U2-U1
+                            const field_value_type S2_minus_S1 = S2 - S1;
+                            const field_value_type I = (H + H).squared();            // I = (2 * H)^2
+                            const field_value_type J = H * I;                        // J = H * I
+                            const field_value_type r = S2_minus_S1 + S2_minus_S1;    // r = 2 * (S2-S1)
+                            const field_value_type V = U1 * I;                       // V = U1 * I
+                            const field_value_type S1_J = S1 * J;
 
-                            return ElementType(X3, Y3, Z3);
+                            first.Z = ((first.Z + second.Z).squared() - Z1Z1 - Z2Z2) * H;    // Z3 = ((Z1+Z2)^2-Z1Z1-Z2Z2) * H
+                            first.X = r.squared() - J - (V + V);                             // X3 = r^2 - J - 2 * V
+                            first.Y = r * (V - first.X) - (S1_J + S1_J);                     // Y3 = r * (V-X3)-2 S1 J
                         }
                     };
 
@@ -36,30 +36,32 @@ namespace nil {
                      *  for jacobian_with_a4_minus_3 coordinates representation.
                      *  NOTE: does not handle O and pts of order 2,4
                      *  http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-madd-2007-bl
+                     *  The result is written into the coordinates of first.
                      */
                     struct short_weierstrass_element_g1_jacobian_with_a4_minus_3_dbl_2007_bl {
 
                         template<typename ElementType>
-                        constexpr static inline ElementType process(const ElementType &first ) {
+                        constexpr static inline void process_inplace(ElementType &first) {
 
                             using field_value_type = typename ElementType::field_type::value_type;
-//u                           //using params_type = CurveParams;
+
                             // handle point at infinity
                             if (first.is_zero()) {
-                                return (first);
+                                return;
                             }
 
-                            field_value_type XX = (first.X).squared();    // XX = X1^2
-                            field_value_type YY = (first.Y).squared();    // YY = Y1^2
-                            field_value_type YYYY = YY.squared();         // YYYY = YY^2
-                            field_value_type ZZ = (first.Z).squared();    // ZZ = Z1^2 
-                            field_value_type S = ((first.X + YY).squared() - XX - YYYY).doubled();          // S = 2*((X1 + YY)^2 -XX - YYYY)
-                            field_value_type M = XX.doubled() + XX - ZZ.squared().doubled()- ZZ.squared();  // M = 3*XX + a*ZZ^2
-                            field_value_type T = M.squared() - S.doubled(); // T = M^2 - 2S
-                            field_value_type X3 = T;                        //X3 = T
-                            field_value_type Y3 = M * (S - T) - YYYY.doubled().doubled().doubled(); // Y3 = M(S - T) - 8Y
-                            field_value_type Z3 = (first.Y + first.Z).squared() - YY - ZZ;          // Z3 = (Y1 + Z1)^2 - YY - ZZ
-                            return ElementType(X3, Y3, Z3);
+                            const field_value_type XX = (first.X).squared();    // XX = X1^2
+                            const field_value_type YY = (first.Y).squared();    // YY = Y1^2
+                            const field_value_type YYYY = YY.squared();         // YYYY = YY^2
+                            const field_value_type ZZ = (first.Z).squared();    // ZZ = Z1^2
+                            // S = 2*((X1 + YY)^2 -XX - YYYY)
+                            const field_value_type S = ((first.X + YY).squared() - XX - YYYY).doubled();
+                            // M = 3*XX + a*ZZ^2
+                            const field_value_type M = XX.doubled() + XX - ZZ.squared().doubled() - ZZ.squared();
+
+                            first.Z = (first.Y + first.Z).squared() - YY - ZZ;    // Z3 = (Y1 + Z1)^2 - YY - ZZ
+                            first.X = M.squared() - S.doubled();                  // X3 = T = M^2 - 2S
+                            first.Y = M * (S - first.X) - YYYY.doubled().doubled().doubled();    // Y3 = M(S - T) - 8Y
                         }
                     };
 
@@ -232,7 +232,7 @@ namespace nil {
 
                         /*************************  Arithmetic operations  ***********************************/
 
-                        constexpr curve_element operator=(const curve_element &other) {
+                        constexpr curve_element &operator=(const curve_element &other) {
                             // handle special cases having to do with O
                             this->X = other.X;
                             this->Y = other.Y;
@@ -241,21 +241,59 @@ namespace nil {
                             return *this;
                         }
 
-                        constexpr curve_element operator+(const curve_element &other) const {
+                        constexpr curve_element &operator+=(const curve_element &other) {
                             // handle special cases having to do with O
                             if (this->is_zero()) {
-                                return other;
+                                return *this = other;
                             }
 
                             if (other.is_zero()) {
-                                return (*this);
+                                return *this;
                             }
 
                             if (*this == other) {
-                                return this->doubled();
+                                return this->double_inplace();
                             }
 
-                            return common_addition_processor::process(*this, other);
+                            common_addition_processor::process_inplace(*this, other);
+                            return *this;
+                        }
+
+                        constexpr curve_element &operator-=(const curve_element &other) {
+                            return *this += -other;
+                        }
+
+                        /** @brief
+                         *
+                         * Doubles the element in place, see doubled().
+                         */
+                        constexpr curve_element &double_inplace() {
+                            common_doubling_processor::process_inplace(*this);
+                            return *this;
+                        }
+
+                        /** @brief
+                         *
+                         * Adds an element with Z2 known to be 1 in place, see mixed_add().
+                         */
+                        constexpr curve_element &mixed_add_inplace(const curve_element &other) {
+                            // handle special cases having to do with O
+                            if (this->is_zero()) {
+                                return *this = other;
+                            }
+
+                            if (other.is_zero()) {
+                                return *this;
+                            }
+
+                            mixed_addition_processor::process_inplace(*this, other);
+                            return *this;
+                        }
+
+                        constexpr curve_element operator+(const curve_element &other) const {
+                            curve_element result = *this;
+                            result += other;
+                            return result;
                         }
 
                         constexpr curve_element operator-() const {
@@ -263,7 +301,9 @@ namespace nil {
                         }
 
                         constexpr curve_element operator-(const curve_element &other) const {
-                            return (*this) + (-other);
+                            curve_element result = *this;
+                            result -= other;
+                            return result;
                         }
 
                         /** @brief
@@ -271,7 +311,9 @@ namespace nil {
                          * @return doubled element from group G1
                          */
                         constexpr curve_element doubled() const {
-                            return common_doubling_processor::process(*this);
+                            curve_element result = *this;
+                            result.double_inplace();
+                            return result;
                         }
 
                         /** @brief
@@ -280,17 +322,9 @@ namespace nil {
                          * @return addition of two elements from group G1
                          */
                         constexpr curve_element mixed_add(const curve_element &other) const {
-
-                            // handle special cases having to do with O
-                            if (this->is_zero()) {
-                                return other;
-                            }
-
-                            if (other.is_zero()) {
-                                return *this;
-                            }
-
-                            return mixed_addition_processor::process(*this, other);
+                            curve_element result = *this;
+                            result.mixed_add_inplace(other);
+                            return result;
                         }
                     };
 
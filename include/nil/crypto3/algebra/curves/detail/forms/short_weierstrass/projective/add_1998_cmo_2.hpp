@@ -36,13 +36,13 @@ namespace nil {
                      *  for projective coordinates representation.
                      *  NOTE: does not handle O and pts of order 2,4
                      *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-projective.html#addition-add-1998-cmo-2
+                     *  The result is written into the coordinates of first.
                      */
 
                     struct short_weierstrass_element_g1_projective_add_1998_cmo_2 {
 
                         template<typename ElementType>
-                        constexpr static inline ElementType process(const ElementType &first,
-                                                                    const ElementType &second) {
+                        constexpr static inline void process_inplace(ElementType &first, const ElementType &second) {
 
                             using field_value_type = typename ElementType::field_type::value_type;
 
@@ -56,11 +56,10 @@ namespace nil {
                             const field_value_type vvv = v * vv;                         // vvv  = v*vv
                             const field_value_type R = vv * X1Z2;                        // R    = vv*X1Z2
                             const field_value_type A = uu * Z1Z2 - (vvv + R + R);        // A    = uu*Z1Z2 - vvv - 2*R
-                            const field_value_type X3 = v * A;                           // X3   = v*A
-                            const field_value_type Y3 = u * (R - A) - vvv * Y1Z2;        // Y3   = u*(R-A) - vvv*Y1Z2
-                            const field_value_type Z3 = vvv * Z1Z2;                      // Z3   = vvv*Z1Z2
 
-                            return ElementType(X3, Y3, Z3);
+                            first.X = v * A;                        // X3   = v*A
+                            first.Y = u * (R - A) - vvv * Y1Z2;     // Y3   = u*(R-A) - vvv*Y1Z2
+                            first.Z = vvv * Z1Z2;                   // Z3   = vvv*Z1Z2
                         }
                     };
 
@@ -31,7 +31,7 @@
 #include <nil/crypto3/algebra/curves/forms.hpp>
 
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
-#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective/add_1998_cmo_2.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective/add_2015_rcb.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective/dbl_2007_bl.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/element_g1_affine.hpp>
 
@@ -62,7 +62,7 @@ namespace nil {
                     private:
                         using field_value_type = typename field_type::value_type;
 
-                        using common_addition_processor = short_weierstrass_element_g1_projective_add_1998_cmo_2;
+                        using common_addition_processor = short_weierstrass_element_g1_projective_add_2015_rcb;
                         using common_doubling_processor = short_weierstrass_element_g1_projective_dbl_2007_bl;
 
                     public:
@@ -195,7 +195,7 @@ namespace nil {
 
                         /*************************  Arithmetic operations  ***********************************/
 
-                        constexpr curve_element operator=(const curve_element &other) {
+                        constexpr curve_element &operator=(const curve_element &other) {
                             // handle special cases having to do with O
                             this->X = other.X;
                             this->Y = other.Y;
@@ -204,21 +204,70 @@ namespace nil {
                             return *this;
                         }
 
-                        constexpr curve_element operator+(const curve_element &other) const {
-                            // handle special cases having to do with O
+                        constexpr curve_element &operator+=(const curve_element &other) {
+                            // The addition formulas are complete, so O and doubling need no special cases, and they
+                            // read both operands before writing, so other may be *this.
+                            common_addition_processor::process_inplace(*this, other);
+                            return *this;
+                        }
+
+                        constexpr curve_element &operator-=(const curve_element &other) {
+                            return *this += -other;
+                        }
+
+                        /** @brief
+                         *
+                         * Doubles the element in place, see doubled().
+                         */
+                        constexpr curve_element &double_inplace() {
+                            common_doubling_processor::process_inplace(*this);
+                            return *this;
+                        }
+
+                        /** @brief
+                         *
+                         * Adds an element with Z2 known to be 1 in place, see mixed_add().
+                         */
+                        constexpr curve_element &mixed_add_inplace(const curve_element &other) {
+                            // NOTE: does not handle O and pts of order 2,4
+                            // http://www.hyperelliptic.org/EFD/g1p/auto-shortw-projective.html#addition-add-1998-cmo-2
+                            // Unlike the complete formulas, these do not use b, so they stay consistent with libff
+                            // when other does not lie on the curve at Z2=1.
+
                             if (this->is_zero()) {
-                                return other;
+                                return *this = other;
                             }
 
                             if (other.is_zero()) {
-                                return (*this);
+                                return *this;
                             }
 
-                            if (*this == other) {
-                                return this->doubled();
+                            const field_value_type X2Z1 = (this->Z) * (other.X);    // X2Z1 = X2*Z1
+                            const field_value_type Y2Z1 = (this->Z) * (other.Y);    // Y2Z1 = Y2*Z1
+
+                            // X1Z2 = X1 and Y1Z2 = Y1, as other is special and not zero
+                            if (this->X == X2Z1 && this->Y == Y2Z1) {
+                                return this->double_inplace();
                             }
 
-                            return common_addition_processor::process(*this, other);
+                            const field_value_type u = Y2Z1 - this->Y;                // u = Y2*Z1-Y1
+                            const field_value_type uu = u.squared();                  // uu = u2
+                            const field_value_type v = X2Z1 - this->X;                // v = X2*Z1-X1
+                            const field_value_type vv = v.squared();                  // vv = v2
+                            const field_value_type vvv = v * vv;                      // vvv = v*vv
+                            const field_value_type R = vv * this->X;                  // R = vv*X1
+                            const field_value_type A = uu * this->Z - vvv - R - R;    // A = uu*Z1-vvv-2*R
+
+                            this->Y = u * (R - A) - vvv * this->Y;    // Y3 = u*(R-A)-vvv*Y1
+                            this->X = v * A;                          // X3 = v*A
+                            this->Z = vvv * this->Z;                  // Z3 = vvv*Z1
+                            return *this;
+                        }
+
+                        constexpr curve_element operator+(const curve_element &other) const {
+                            curve_element result = *this;
+                            result += other;
+                            return result;
                         }
 
                         constexpr curve_element operator-() const {
@@ -226,7 +275,9 @@ namespace nil {
                         }
 
                         constexpr curve_element operator-(const curve_element &other) const {
-                            return (*this) + (-other);
+                            curve_element result = *this;
+                            result -= other;
+                            return result;
                         }
 
                         /** @brief
@@ -234,7 +285,9 @@ namespace nil {
                          * @return doubled element from group G1
                          */
                         constexpr curve_element doubled() const {
-                            return common_doubling_processor::process(*this);
+                            curve_element result = *this;
+                            result.double_inplace();
+                            return result;
                         }
 
                         /** @brief
@@ -243,47 +296,9 @@ namespace nil {
                          * @return addition of two elements from group G1
                          */
                         constexpr curve_element mixed_add(const curve_element &other) const {
-
-                            // NOTE: does not handle O and pts of order 2,4
-                            // http://www.hyperelliptic.org/EFD/g1p/auto-shortw-projective.html#addition-add-1998-cmo-2
-
-                            if (this->is_zero()) {
-                                return other;
-                            }
-
-                            if (other.is_zero()) {
-                                return (*this);
-                            }
-
-                            // Because for some reasons it's not so
-                            // assert(other.Z == field_value_type::one());
-
-                            const field_value_type &X1Z2 =
-                                (this->X);    // X1Z2 = X1*Z2 (but other is special and not zero)
-                            const field_value_type X2Z1 = (this->Z) * (other.X);    // X2Z1 = X2*Z1
-
-                            // (used both in add and double checks)
-
-                            const field_value_type &Y1Z2 =
-                                (this->Y);    // Y1Z2 = Y1*Z2 (but other is special and not zero)
-                            const field_value_type Y2Z1 = (this->Z) * (other.Y);    // Y2Z1 = Y2*Z1
-
-                            if (X1Z2 == X2Z1 && Y1Z2 == Y2Z1) {
-                                return this->doubled();
-                            }
-
-                            const field_value_type u = Y2Z1 - this->Y;                  // u = Y2*Z1-Y1
-                            const field_value_type uu = u.squared();                    // uu = u2
-                            const field_value_type v = X2Z1 - this->X;                  // v = X2*Z1-X1
-                            const field_value_type vv = v.squared();                    // vv = v2
-                            const field_value_type vvv = v * vv;                        // vvv = v*vv
-                            const field_value_type R = vv * this->X;                    // R = vv*X1
-                            const field_value_type A = uu * this->Z - vvv - R - R;      // A = uu*Z1-vvv-2*R
-                            const field_value_type X3 = v * A;                          // X3 = v*A
-                            const field_value_type Y3 = u * (R - A) - vvv * this->Y;    // Y3 = u*(R-A)-vvv*Y1
-                            const field_value_type Z3 = vvv * this->Z;                  // Z3 = vvv*Z1
-
-                            return curve_element(X3, Y3, Z3);
+                            curve_element result = *this;
+                            result.mixed_add_inplace(other);
+                            return result;
                         }
                     };
 
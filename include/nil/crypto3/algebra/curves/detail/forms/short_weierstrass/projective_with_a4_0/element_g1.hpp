@@ -0,0 +1,286 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_0_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_0_HPP
+
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_with_a4_0/add_2015_rcb.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_with_a4_0/dbl_2015_rcb.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_with_a4_0/madd_2015_rcb.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/element_g1_affine.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing a group G1 of elliptic curve.
+                     *    @tparam CurveParams Parameters of the group
+                     *    @tparam Form Form of the curve
+                     *    @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    struct curve_element;
+
+                    /** @brief A struct representing an element from the group G1 of short Weierstrass curve of
+                     *  projective coordinates representation with a = 0 and complete addition formulas.
+                     *  Description: https://hyperelliptic.org/EFD/g1p/auto-shortw-projective.html
+                     *
+                     */
+                    template<typename CurveParams>
+                    struct curve_element<CurveParams, forms::short_weierstrass, coordinates::projective_with_a4_0> {
+
+                        using params_type = CurveParams;
+                        using field_type = typename params_type::field_type;
+
+                    private:
+                        using field_value_type = typename field_type::value_type;
+
+                        using common_addition_processor = short_weierstrass_element_g1_projective_with_a4_0_add_2015_rcb;
+                        using common_doubling_processor = short_weierstrass_element_g1_projective_with_a4_0_dbl_2015_rcb;
+                        using mixed_addition_processor = short_weierstrass_element_g1_projective_with_a4_0_madd_2015_rcb;
+
+                    public:
+                        using form = forms::short_weierstrass;
+                        using coordinates = coordinates::projective_with_a4_0;
+
+                        using group_type = typename params_type::template group_type<coordinates>;
+
+                        field_value_type X;
+                        field_value_type Y;
+                        field_value_type Z;
+
+                        /*************************  Constructors and zero/one  ***********************************/
+
+                        /** @brief
+                         *    @return the point at infinity by default
+                         *
+                         */
+                        constexpr curve_element() :
+                            curve_element(params_type::zero_fill[0],
+                                          params_type::zero_fill[1],
+                                          field_value_type::zero()) {};
+
+                        /** @brief
+                         *    @return the selected point (X:Y:Z)
+                         *
+                         */
+                        constexpr curve_element(field_value_type X, field_value_type Y, field_value_type Z) {
+                            this->X = X;
+                            this->Y = Y;
+                            this->Z = Z;
+                        };
+
+                        /** @brief Get the point at infinity
+                         *
+                         */
+                        constexpr static curve_element zero() {
+                            return curve_element();
+                        }
+
+                        /** @brief Get the generator of group G1
+                         *
+                         */
+                        constexpr static curve_element one() {
+                            return curve_element(params_type::one_fill[0], params_type::one_fill[1],
+                                                 field_value_type::one());
+                        }
+
+                        /*************************  Comparison operations  ***********************************/
+
+                        constexpr bool operator==(const curve_element &other) const {
+                            if (this->is_zero()) {
+                                return other.is_zero();
+                            }
+
+                            if (other.is_zero()) {
+                                return false;
+                            }
+
+                            /* now neither is O */
+
+                            // X1/Z1 = X2/Z2 <=> X1*Z2 = X2*Z1
+                            if ((this->X * other.Z) != (other.X * this->Z)) {
+                                return false;
+                            }
+
+                            // Y1/Z1 = Y2/Z2 <=> Y1*Z2 = Y2*Z1
+                            if ((this->Y * other.Z) != (other.Y * this->Z)) {
+                                return false;
+                            }
+
+                            return true;
+                        }
+
+                        constexpr bool operator!=(const curve_element &other) const {
+                            return !(operator==(other));
+                        }
+                        /** @brief
+                         *
+                         * @return true if element from group G1 is the point at infinity
+                         */
+                        constexpr bool is_zero() const {
+                            return (this->X.is_zero() && this->Z.is_zero());
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 lies on the elliptic curve
+                         */
+                        constexpr bool is_well_formed() const {
+                            if (this->is_zero()) {
+                                return true;
+                            } else {
+                                /*
+                                  y^2 = x^3 + b
+
+                                  We are using projective, so equation we need to check is actually
+
+                                  (y/z)^2 = (x/z)^3 + b
+                                  z y^2 = x^3 + b z^3
+
+                                  z (y^2 - b z^2) = x^3
+                                */
+                                const field_value_type X2 = this->X.squared();
+                                const field_value_type Y2 = this->Y.squared();
+                                const field_value_type Z2 = this->Z.squared();
+
+                                return (this->Z * (Y2 - params_type::b * Z2) == this->X * X2);
+                            }
+                        }
+
+                        /*************************  Reducing operations  ***********************************/
+
+                        /** @brief
+                         *
+                         * @return return the corresponding element from projective coordinates to
+                         * affine coordinates
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::affine>
+                            to_affine() const {
+
+                            using result_type = curve_element<params_type, form, typename curves::coordinates::affine>;
+
+                            if (is_zero()) {
+                                return result_type::zero();
+                            }
+
+                            return result_type(X * Z.inversed(), Y * Z.inversed());    //  x=X/Z, y=Y/Z
+                        }
+
+                        /*************************  Arithmetic operations  ***********************************/
+
+                        constexpr curve_element &operator=(const curve_element &other) {
+                            // handle special cases having to do with O
+                            this->X = other.X;
+                            this->Y = other.Y;
+                            this->Z = other.Z;
+
+                            return *this;
+                        }
+
+                        constexpr curve_element &operator+=(const curve_element &other) {
+                            // The addition formulas are complete, so O and doubling need no special cases, and they
+                            // read both operands before writing, so other may be *this.
+                            common_addition_processor::process_inplace(*this, other);
+                            return *this;
+                        }
+
+                        constexpr curve_element &operator-=(const curve_element &other) {
+                            return *this += -other;
+                        }
+
+                        /** @brief
+                         *
+                         * Doubles the element in place, see doubled().
+                         */
+                        constexpr curve_element &double_inplace() {
+                            common_doubling_processor::process_inplace(*this);
+                            return *this;
+                        }
+
+                        /** @brief
+                         *
+                         * Adds an element with Z2 known to be 1 in place, see mixed_add().
+                         */
+                        constexpr curve_element &mixed_add_inplace(const curve_element &other) {
+                            // O has no representation with Z2=1
+                            if (other.is_zero()) {
+                                return *this;
+                            }
+
+                            mixed_addition_processor::process_inplace(*this, other);
+                            return *this;
+                        }
+
+                        constexpr curve_element operator+(const curve_element &other) const {
+                            curve_element result = *this;
+                            result += other;
+                            return result;
+                        }
+
+                        constexpr curve_element operator-() const {
+                            return curve_element(this->X, -this->Y, this->Z);
+                        }
+
+                        constexpr curve_element operator-(const curve_element &other) const {
+                            curve_element result = *this;
+                            result -= other;
+                            return result;
+                        }
+
+                        /** @brief
+                         *
+                         * @return doubled element from group G1
+                         */
+                        constexpr curve_element doubled() const {
+                            curve_element result = *this;
+                            result.double_inplace();
+                            return result;
+                        }
+
+                        /** @brief
+                         *
+                         * “Mixed addition” refers to the case Z2 known to be 1.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element mixed_add(const curve_element &other) const {
+                            curve_element result = *this;
+                            result.mixed_add_inplace(other);
+                            return result;
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_0_HPP
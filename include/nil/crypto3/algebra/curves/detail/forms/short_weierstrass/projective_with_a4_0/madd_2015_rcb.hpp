@@ -0,0 +1,77 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_0_MADD_2015_RCB_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_0_MADD_2015_RCB_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing element mixed addition from the group G1 of short Weierstrass curve
+                     *  for projective_with_a4_0 coordinates representation.
+                     *  Complete formulas, exception-free on curves of odd order:
+                     *  Renes, Costello, Batina, "Complete addition formulas for prime order elliptic curves",
+                     *  algorithm 8
+                     *  Assumes Z2=1, so the second point must not be O.
+                     *  https://eprint.iacr.org/2015/1060
+                     *  The result is written into the coordinates of first.
+                     */
+                    struct short_weierstrass_element_g1_projective_with_a4_0_madd_2015_rcb {
+
+                        template<typename ElementType>
+                        constexpr static inline void process_inplace(ElementType &first, const ElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            const field_value_type b = ElementType::params_type::b;
+                            const field_value_type b3 = b.doubled() + b;                // b3 = 3*b
+                            const field_value_type A = first.X * second.X;              // A = X1*X2
+                            const field_value_type B = first.Y * second.Y;              // B = Y1*Y2
+                            const field_value_type C = first.Z;                         // C = Z1
+                            // D = (X1+Y1)*(X2+Y2) - A - B
+                            const field_value_type D = (first.X + first.Y) * (second.X + second.Y) - A - B;
+                            const field_value_type E = second.X * first.Z + first.X;    // E = X2*Z1 + X1
+                            const field_value_type F = second.Y * first.Z + first.Y;    // F = Y2*Z1 + Y1
+                            const field_value_type G = b3 * C;                          // G = b3*C
+                            const field_value_type H = B - G;                           // H = B - G
+                            const field_value_type I = B + G;                           // I = B + G
+                            const field_value_type J = A.doubled() + A;                 // J = 3*A
+                            const field_value_type K = b3 * E;                          // K = b3*E
+
+                            first.X = D * H - F * K;    // X3 = D*H - F*K
+                            first.Y = H * I + J * K;    // Y3 = H*I + J*K
+                            first.Z = F * I + D * J;    // Z3 = F*I + D*J
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_0_MADD_2015_RCB_HPP
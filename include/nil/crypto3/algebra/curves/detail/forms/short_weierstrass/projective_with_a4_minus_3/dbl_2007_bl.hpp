@@ -37,37 +37,35 @@ namespace nil {
                      *  for projective_with_a4_minus_3 coordinates representation.
                      *  NOTE: does not handle O and pts of order 2,4
                      *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-projective-3.html#doubling-dbl-2007-bl
+                     *  The result is written into the coordinates of first.
                      */
                     struct short_weierstrass_element_g1_projective_with_a4_minus_3_dbl_2007_bl {
 
                         template<typename ElementType>
-                        constexpr static inline ElementType process(const ElementType &first) {
+                        constexpr static inline void process_inplace(ElementType &first) {
 
                             using field_value_type = typename ElementType::field_type::value_type;
 
                             if (first.is_zero()) {
-                                return ElementType::zero();
-                            } else {
+                                first = ElementType::zero();
+                                return;
+                            }
 
-                                const field_value_type XX = (first.X).squared();    // XX  = X1^2
-                                const field_value_type ZZ = (first.Z).squared();    // ZZ  = Z1^2
-                                const field_value_type w =
-                                    ElementType::params_type::a * ZZ + (XX + XX + XX);    // w   = a*ZZ + 3*XX
-                                const field_value_type Y1Z1 = (first.Y) * (first.Z);
-                                const field_value_type s = Y1Z1 + Y1Z1;      // s   = 2*Y1*Z1
-                                const field_value_type ss = s.squared();     // ss  = s^2
-                                const field_value_type sss = s * ss;         // sss = s*ss
-                                const field_value_type R = (first.Y) * s;    // R   = Y1*s
-                                const field_value_type RR = R.squared();     // RR  = R^2
-                                const field_value_type B =
-                                    ((first.X) + R).squared() - XX - RR;                   // B   = (X1+R)^2 - XX - RR
-                                const field_value_type h = w.squared() - B.doubled();      // h   = w^2 - 2*B
-                                const field_value_type X3 = h * s;                         // X3  = h*s
-                                const field_value_type Y3 = w * (B - h) - RR.doubled();    // Y3  = w*(B-h) - 2*RR
-                                const field_value_type Z3 = sss;                           // Z3  = sss
+                            const field_value_type XX = (first.X).squared();    // XX  = X1^2
+                            const field_value_type ZZ = (first.Z).squared();    // ZZ  = Z1^2
+                            const field_value_type w =
+                                ElementType::params_type::a * ZZ + (XX + XX + XX);    // w   = a*ZZ + 3*XX
+                            const field_value_type Y1Z1 = (first.Y) * (first.Z);
+                            const field_value_type s = Y1Z1 + Y1Z1;      // s   = 2*Y1*Z1
+                            const field_value_type ss = s.squared();     // ss  = s^2
+                            const field_value_type R = (first.Y) * s;    // R   = Y1*s
+                            const field_value_type RR = R.squared();     // RR  = R^2
+                            const field_value_type B = ((first.X) + R).squared() - XX - RR;    // B   = (X1+R)^2 - XX - RR
+                            const field_value_type h = w.squared() - B.doubled();              // h   = w^2 - 2*B
 
-                                return ElementType(X3, Y3, Z3);
-                            }
+                            first.X = h * s;                           // X3  = h*s
+                            first.Y = w * (B - h) - RR.doubled();      // Y3  = w*(B-h) - 2*RR
+                            first.Z = s * ss;                          // Z3  = sss = s*ss
                         }
                     };
 
@@ -197,7 +197,7 @@ namespace nil {
 
                         /*************************  Arithmetic operations  ***********************************/
 
-                        constexpr curve_element operator=(const curve_element &other) {
+                        constexpr curve_element &operator=(const curve_element &other) {
                             // handle special cases having to do with O
                             this->X = other.X;
                             this->Y = other.Y;
@@ -206,86 +206,113 @@ namespace nil {
                             return *this;
                         }
 
-                        constexpr curve_element operator+(const curve_element &other) const {
+                        constexpr curve_element &operator+=(const curve_element &other) {
                             // handle special cases having to do with O
                             if (this->is_zero()) {
-                                return other;
+                                return *this = other;
                             }
 
                             if (other.is_zero()) {
-                                return (*this);
+                                return *this;
                             }
 
                             if (*this == other) {
-                                return this->doubled();
+                                return this->double_inplace();
                             }
 
-                            return common_addition_processor::process(*this, other);
+                            common_addition_processor::process_inplace(*this, other);
+                            return *this;
                         }
 
-                        constexpr curve_element operator-() const {
-                            return curve_element(this->X, -this->Y, this->Z);
-                        }
-
-                        constexpr curve_element operator-(const curve_element &other) const {
-                            return (*this) + (-other);
+                        constexpr curve_element &operator-=(const curve_element &other) {
+                            return *this += -other;
                         }
 
                         /** @brief
                          *
-                         * @return doubled element from group G1
+                         * Doubles the element in place, see doubled().
                          */
-                        constexpr curve_element doubled() const {
-                            return common_doubling_processor::process(*this);
+                        constexpr curve_element &double_inplace() {
+                            common_doubling_processor::process_inplace(*this);
+                            return *this;
                         }
 
                         /** @brief
                          *
-                         * “Mixed addition” refers to the case Z2 known to be 1.
-                         * @return addition of two elements from group G1
+                         * Adds an element with Z2 known to be 1 in place, see mixed_add().
                          */
-                        constexpr curve_element mixed_add(const curve_element &other) const {
-
+                        constexpr curve_element &mixed_add_inplace(const curve_element &other) {
                             // NOTE: does not handle O and pts of order 2,4
                             // http://www.hyperelliptic.org/EFD/g1p/auto-shortw-projective_with_a4_minus_3.html#addition-add-1998-cmo-2
 
                             if (this->is_zero()) {
-                                return other;
+                                return *this = other;
                             }
 
                             if (other.is_zero()) {
-                                return (*this);
+                                return *this;
                             }
 
                             // Because for some reasons it's not so
                             // assert(other.Z == field_value_type::one());
 
-                            const field_value_type &X1Z2 =
-                                (this->X);    // X1Z2 = X1*Z2 (but other is special and not zero)
                             const field_value_type X2Z1 = (this->Z) * (other.X);    // X2Z1 = X2*Z1
-
-                            // (used both in add and double checks)
-
-                            const field_value_type &Y1Z2 =
-                                (this->Y);    // Y1Z2 = Y1*Z2 (but other is special and not zero)
                             const field_value_type Y2Z1 = (this->Z) * (other.Y);    // Y2Z1 = Y2*Z1
 
-                            if (X1Z2 == X2Z1 && Y1Z2 == Y2Z1) {
-                                return this->doubled();
+                            // X1Z2 = X1 and Y1Z2 = Y1, as other is special and not zero
+                            if (this->X == X2Z1 && this->Y == Y2Z1) {
+                                return this->double_inplace();
                             }
 
-                            const field_value_type u = Y2Z1 - this->Y;                  // u = Y2*Z1-Y1
-                            const field_value_type uu = u.squared();                    // uu = u2
-                            const field_value_type v = X2Z1 - this->X;                  // v = X2*Z1-X1
-                            const field_value_type vv = v.squared();                    // vv = v2
-                            const field_value_type vvv = v * vv;                        // vvv = v*vv
-                            const field_value_type R = vv * this->X;                    // R = vv*X1
-                            const field_value_type A = uu * this->Z - vvv - R - R;      // A = uu*Z1-vvv-2*R
-                            const field_value_type X3 = v * A;                          // X3 = v*A
-                            const field_value_type Y3 = u * (R - A) - vvv * this->Y;    // Y3 = u*(R-A)-vvv*Y1
-                            const field_value_type Z3 = vvv * this->Z;                  // Z3 = vvv*Z1
-
-                            return curve_element(X3, Y3, Z3);
+                            const field_value_type u = Y2Z1 - this->Y;                // u = Y2*Z1-Y1
+                            const field_value_type uu = u.squared();                  // uu = u2
+                            const field_value_type v = X2Z1 - this->X;                // v = X2*Z1-X1
+                            const field_value_type vv = v.squared();                  // vv = v2
+                            const field_value_type vvv = v * vv;                      // vvv = v*vv
+                            const field_value_type R = vv * this->X;                  // R = vv*X1
+                            const field_value_type A = uu * this->Z - vvv - R - R;    // A = uu*Z1-vvv-2*R
+
+                            this->Y = u * (R - A) - vvv * this->Y;    // Y3 = u*(R-A)-vvv*Y1
+                            this->X = v * A;                          // X3 = v*A
+                            this->Z = vvv * this->Z;                  // Z3 = vvv*Z1
+                            return *this;
+                        }
+
+                        constexpr curve_element operator+(const curve_element &other) const {
+                            curve_element result = *this;
+                            result += other;
+                            return result;
+                        }
+
+                        constexpr curve_element operator-() const {
+                            return curve_element(this->X, -this->Y, this->Z);
+                        }
+
+                        constexpr curve_element operator-(const curve_element &other) const {
+                            curve_element result = *this;
+                            result -= other;
+                            return result;
+                        }
+
+                        /** @brief
+                         *
+                         * @return doubled element from group G1
+                         */
+                        constexpr curve_element doubled() const {
+                            curve_element result = *this;
+                            result.double_inplace();
+                            return result;
+                        }
+
+                        /** @brief
+                         *
+                         * “Mixed addition” refers to the case Z2 known to be 1.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element mixed_add(const curve_element &other) const {
+                            curve_element result = *this;
+                            result.mixed_add_inplace(other);
+                            return result;
                         }
                     };
 
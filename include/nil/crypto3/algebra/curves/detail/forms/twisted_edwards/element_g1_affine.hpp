@@ -28,6 +28,7 @@
 #define CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_AFFINE_HPP
 
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/inplace_arithmetic.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/montgomery/coordinates.hpp>
@@ -52,7 +53,8 @@ namespace nil {
                      *
                      */
                     template<typename CurveParams>
-                    struct curve_element<CurveParams, forms::twisted_edwards, coordinates::affine> {
+                    struct curve_element<CurveParams, forms::twisted_edwards, coordinates::affine>
+                        : public inplace_arithmetic<curve_element<CurveParams, forms::twisted_edwards, coordinates::affine>> {
 
                         using field_type = typename CurveParams::field_type;
 
@@ -204,6 +206,21 @@ namespace nil {
                                                result_type::field_type::value_type::one());    // x=X/Z, y=Y/Z, x*y=T/Z
                         }
 
+                        /** @brief
+                         *
+                         * @return return the corresponding element from affine coordinates to
+                         * extended coordinates
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::extended>
+                            to_extended() const {
+
+                            using result_type =
+                                curve_element<params_type, form, typename curves::coordinates::extended>;
+
+                            return result_type(X, Y, X * Y,
+                                               result_type::field_type::value_type::one());    // x=X/Z, y=Y/Z, x*y=T/Z
+                        }
+
                         /** @brief
                          *
                          * @return return the corresponding element from affine coordinates to
@@ -215,7 +232,7 @@ namespace nil {
 
                         /*************************  Arithmetic operations  ***********************************/
 
-                        constexpr curve_element operator=(const curve_element &other) {
+                        constexpr curve_element &operator=(const curve_element &other) {
                             // handle special cases having to do with O
                             this->X = other.X;
                             this->Y = other.Y;
@@ -248,6 +265,9 @@ namespace nil {
                             return (*this) + (-B);
                         }
                         /** @brief
+                         * Affine doubling formulas: 2(x1,y1)=(x3,y3) where
+                         *   x3 = 2*x1*y1/(a*x1^2+y1^2)
+                         *   y3 = (y1^2-a*x1^2)/(2-a*x1^2-y1^2)
                          *
                          * @return doubled element from group G1
                          */
@@ -257,30 +277,79 @@ namespace nil {
                                 return (*this);
                             } else {
 
-                                return this->add(*this);    // Temporary intil we find something more efficient
+                                return this->doubled_with_inverse(this->doubling_denominator().inversed());
                             }
                         }
 
-                    private:
                         /** @brief
-                         * Affine addition formulas: (x1,y1)+(x2,y2)=(x3,y3) where
-                         *   x3 = (x1*y2+y1*x2)/(1+d*x1*x2*y1*y2)
-                         *   y3 = (y1*y2-a*x1*x2)/(1-d*x1*x2*y1*y2)
+                         *
+                         * @return the field element doubled() divides by, (a*x1^2+y1^2)*(2-a*x1^2-y1^2)
                          */
-                        curve_element add(const curve_element &other) const {
+                        constexpr field_value_type doubling_denominator() const {
+                            field_value_type aXX = params_type::a * this->X.squared();
+                            field_value_type aXXpYY = aXX + this->Y.squared();
+
+                            return aXXpYY * (field_value_type(2) - aXXpYY);
+                        }
+
+                        /** @brief
+                         *
+                         * Finishes doubled() given the inverse of doubling_denominator(), so that many doublings
+                         * can share one inversion, see batch_affine_double().
+                         */
+                        constexpr curve_element doubled_with_inverse(const field_value_type &inverse) const {
+                            field_value_type aXX = params_type::a * this->X.squared();
+                            field_value_type YY = this->Y.squared();
+                            field_value_type aXXpYY = aXX + YY;
+
+                            field_value_type X3 =
+                                (this->X * this->Y).doubled() * (field_value_type(2) - aXXpYY) * inverse;
+                            field_value_type Y3 = (YY - aXX) * aXXpYY * inverse;
+
+                            return curve_element(X3, Y3);
+                        }
+
+                        /** @brief
+                         *
+                         * @return the field element the addition of other divides by,
+                         * (1+d*x1*x2*y1*y2)*(1-d*x1*x2*y1*y2)
+                         */
+                        constexpr field_value_type addition_denominator(const curve_element &other) const {
+                            field_value_type lambda = params_type::d * (this->X) * (other.X) * (this->Y) * (other.Y);
+
+                            return field_value_type::one() - lambda.squared();
+                        }
+
+                        /** @brief
+                         *
+                         * Finishes the addition of other given the inverse of addition_denominator(other), see
+                         * batch_affine_add().
+                         */
+                        constexpr curve_element add_with_inverse(const curve_element &other,
+                                                                 const field_value_type &inverse) const {
                             field_value_type XX = (this->X) * (other.X);
                             field_value_type YY = (this->Y) * (other.Y);
                             field_value_type XY = (this->X) * (other.Y);
                             field_value_type YX = (this->Y) * (other.X);
 
                             field_value_type lambda = params_type::d * XX * YY;
-                            field_value_type X3 = (XY + YX) * (field_value_type::one() + lambda).inversed();
+                            field_value_type X3 = (XY + YX) * (field_value_type::one() - lambda) * inverse;
                             field_value_type Y3 =
-                                (YY - params_type::a * XX) * (field_value_type::one() - lambda).inversed();
+                                (YY - params_type::a * XX) * (field_value_type::one() + lambda) * inverse;
 
                             return curve_element(X3, Y3);
                         }
 
+                    private:
+                        /** @brief
+                         * Affine addition formulas: (x1,y1)+(x2,y2)=(x3,y3) where
+                         *   x3 = (x1*y2+y1*x2)/(1+d*x1*x2*y1*y2)
+                         *   y3 = (y1*y2-a*x1*x2)/(1-d*x1*x2*y1*y2)
+                         */
+                        curve_element add(const curve_element &other) const {
+                            return this->add_with_inverse(other, this->addition_denominator(other).inversed());
+                        }
+
                     public:
                         /*************************  Reducing operations  ***********************************/
 
@@ -36,6 +36,7 @@ namespace nil {
                      *  for extended coordinates with a=-1 representation.
                      *  https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#doubling-dbl-2008-hwcd
                      *  https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.4
+                     *  The formulas map the point at infinity to itself, so they need no branch on it.
                      */
 
                     struct twisted_edwards_element_g1_extended_with_a_minus_1_dbl_2008_hwcd {
@@ -45,25 +46,20 @@ namespace nil {
 
                             using field_value_type = typename ElementType::field_type::value_type;
 
-                            if (first.is_zero()) {
-                                return (first);
-                            } else {
+                            field_value_type A = (first.X).squared();                        // A = X1^2
+                            field_value_type B = (first.Y).squared();                        // B = Y1^2
+                            field_value_type C = field_value_type(2) * first.Z.squared();    // C = 2*Z1^2
+                            field_value_type D = ElementType::params_type::a * A;            // D = a*A
+                            field_value_type E = (first.X + first.Y).squared() - A - B;      // E = (X1+Y1)^2-A-B
+                            field_value_type G = D + B;                                      // G = D+B
+                            field_value_type F = G - C;                                      // F = G-C
+                            field_value_type H = D - B;                                      // H = D-B
+                            field_value_type X3 = E * F;                                     // X3 = E*F
+                            field_value_type Y3 = G * H;                                     // Y3 = G*H
+                            field_value_type T3 = E * H;                                     // T3 = E*H
+                            field_value_type Z3 = F * G;                                     // Z3 = F*G
 
-                                field_value_type A = (first.X).squared();                        // A = X1^2
-                                field_value_type B = (first.Y).squared();                        // B = Y1^2
-                                field_value_type C = field_value_type(2) * first.Z.squared();    // C = 2*Z1^2
-                                field_value_type D = ElementType::params_type::a * A;            // D = a*A
-                                field_value_type E = (first.X + first.Y).squared() - A - B;      // E = (X1+Y1)^2-A-B
-                                field_value_type G = D + B;                                      // G = D+B
-                                field_value_type F = G - C;                                      // F = G-C
-                                field_value_type H = D - B;                                      // H = D-B
-                                field_value_type X3 = E * F;                                     // X3 = E*F
-                                field_value_type Y3 = G * H;                                     // Y3 = G*H
-                                field_value_type T3 = E * H;                                     // T3 = E*H
-                                field_value_type Z3 = F * G;                                     // Z3 = F*G
-
-                                return ElementType(X3, Y3, T3, Z3);
-                            }
+                            return ElementType(X3, Y3, T3, Z3);
                         }
                     };
 
@@ -27,12 +27,14 @@
 #define CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_HPP
 
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/inplace_arithmetic.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
 
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/add_2008_hwcd_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/add_2008_hwcd_3_cached.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/dbl_2008_hwcd.hpp>
-#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/madd_2008_hwcd_2.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/madd_2008_hwcd_3.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/element_g1_affine.hpp>
 
 namespace nil {
@@ -54,7 +56,8 @@ namespace nil {
                      *
                      */
                     template<typename CurveParams>
-                    struct curve_element<CurveParams, forms::twisted_edwards, coordinates::extended_with_a_minus_1> {
+                    struct curve_element<CurveParams, forms::twisted_edwards, coordinates::extended_with_a_minus_1>
+                        : public inplace_arithmetic<curve_element<CurveParams, forms::twisted_edwards, coordinates::extended_with_a_minus_1>> {
 
                         using params_type = CurveParams;
                         using field_type = typename params_type::field_type;
@@ -66,8 +69,10 @@ namespace nil {
                             twisted_edwards_element_g1_extended_with_a_minus_1_add_2008_hwcd_3;
                         using common_doubling_processor =
                             twisted_edwards_element_g1_extended_with_a_minus_1_dbl_2008_hwcd;
-                        using mixed_addition_processor =
-                            twisted_edwards_element_g1_extended_with_a_minus_1_madd_2008_hwcd_2;
+                        using precomputed_addition_processor =
+                            twisted_edwards_element_g1_extended_with_a_minus_1_madd_2008_hwcd_3;
+                        using cached_addition_processor =
+                            twisted_edwards_element_g1_extended_with_a_minus_1_add_2008_hwcd_3_cached;
 
                     public:
                         using form = forms::twisted_edwards;
@@ -80,6 +85,35 @@ namespace nil {
                         field_value_type T;
                         field_value_type Z;
 
+                        /** @brief Affine element stored as (y+x, y-x, 2*d*x*y), the form tables of fixed points
+                         *  are kept in: adding it costs 7 multiplications and needs no d*T2 product.
+                         *
+                         */
+                        struct precomputed_type {
+                            field_value_type YplusX;
+                            field_value_type YminusX;
+                            field_value_type T2d;
+
+                            constexpr precomputed_type operator-() const {
+                                return {YminusX, YplusX, -T2d};
+                            }
+                        };
+
+                        /** @brief Element stored as (Y+X, Y-X, 2*Z, 2*d*T) for points that are added many times,
+                         *  e.g. wNAF tables and multiexp bases.
+                         *
+                         */
+                        struct cached_type {
+                            field_value_type YplusX;
+                            field_value_type YminusX;
+                            field_value_type Z2;
+                            field_value_type T2d;
+
+                            constexpr cached_type operator-() const {
+                                return {YminusX, YplusX, Z2, -T2d};
+                            }
+                        };
+
                         /*************************  Constructors and zero/one  ***********************************/
 
                         /** @brief
@@ -162,16 +196,23 @@ namespace nil {
                          * @return true if element from group G1 is the point at infinity
                          */
                         constexpr bool is_zero() const {
-                            return (this->X.is_zero() && this->T.is_zero() && this->Z.is_zero());
+                            // the neutral element is (0:1:0:1)
+                            return this->X.is_zero() && this->Y == this->Z;
                         }
 
                         /** @brief
                          *
                          * @return true if element from group G1 lies on the elliptic curve
+                         *
+                         * A check, that (Y^2 - X^2)*Z^2 = Z^4 + d*X^2*Y^2 and X*Y = T*Z
                          */
                         constexpr bool is_well_formed() const {
-                            assert(false && "Not implemented yet.");
-                            return true;
+                            field_value_type XX = this->X.squared();
+                            field_value_type YY = this->Y.squared();
+                            field_value_type ZZ = this->Z.squared();
+
+                            return !this->Z.is_zero() && this->X * this->Y == this->T * this->Z &&
+                                   (YY - XX) * ZZ == ZZ.squared() + field_value_type(params_type::d) * XX * YY;
                         }
 
                         /*************************  Reducing operations  ***********************************/
@@ -193,9 +234,29 @@ namespace nil {
                             return result_type(X / Z, Y / Z);    //  x=X/Z, y=Y/Z
                         }
 
+                        /** @brief
+                         *
+                         * @return return the corresponding element in precomputed form (y+x, y-x, 2*d*x*y)
+                         */
+                        constexpr precomputed_type to_precomputed() const {
+                            const field_value_type Z_inv = Z.inversed();
+                            const field_value_type x = X * Z_inv;
+                            const field_value_type y = Y * Z_inv;
+
+                            return {y + x, y - x, (field_value_type(params_type::d) * x * y).doubled()};
+                        }
+
+                        /** @brief
+                         *
+                         * @return return the corresponding element in cached form (Y+X, Y-X, 2*Z, 2*d*T)
+                         */
+                        constexpr cached_type to_cached() const {
+                            return {Y + X, Y - X, Z.doubled(), (field_value_type(params_type::d) * T).doubled()};
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
-                        constexpr curve_element operator=(const curve_element &other) {
+                        constexpr curve_element &operator=(const curve_element &other) {
                             // handle special cases having to do with O
                             this->X = other.X;
                             this->Y = other.Y;
@@ -205,20 +266,13 @@ namespace nil {
                             return *this;
                         }
 
+                        /** @brief
+                         *
+                         * The unified formula is complete for a square a and a non-square d, so it needs no
+                         * branch on O or on doubling.
+                         * @return addition of two elements from group G1
+                         */
                         constexpr curve_element operator+(const curve_element &other) const {
-                            // handle special cases having to do with O
-                            if (this->is_zero()) {
-                                return other;
-                            }
-
-                            if (other.is_zero()) {
-                                return (*this);
-                            }
-
-                            if (*this == other) {
-                                return this->doubled();
-                            }
-
                             return common_addition_processor::process(*this, other);
                         }
 
@@ -230,6 +284,19 @@ namespace nil {
                             return (*this) + (-other);
                         }
 
+                        /** @brief
+                         *
+                         * Unified addition of an element in cached form, see to_cached().
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element operator+(const cached_type &other) const {
+                            return cached_addition_processor::process(*this, other);
+                        }
+
+                        constexpr curve_element operator-(const cached_type &other) const {
+                            return cached_addition_processor::process(*this, -other);
+                        }
+
                         /** @brief
                          *
                          * @return doubled element from group G1
@@ -240,21 +307,23 @@ namespace nil {
 
                         /** @brief
                          *
-                         * “Mixed addition” refers to the case Z2 known to be 1.
+                         * “Mixed addition” refers to the case Z2 known to be 1. With Z2 = 1 the precomputed form
+                         * needs no inversion, and its unified formula doubles and handles O without a branch.
                          * @return addition of two elements from group G1
                          */
-                        curve_element mixed_add(const curve_element &other) const {
-
-                            // handle special cases having to do with O
-                            if (this->is_zero()) {
-                                return other;
-                            }
-
-                            if (other.is_zero()) {
-                                return *this;
-                            }
+                        constexpr curve_element mixed_add(const curve_element &other) const {
+                            return precomputed_addition_processor::process(
+                                *this, precomputed_type {other.Y + other.X, other.Y - other.X,
+                                                         (field_value_type(params_type::d) * other.T).doubled()});
+                        }
 
-                            return mixed_addition_processor::process(*this, other);
+                        /** @brief
+                         *
+                         * Unified addition of an element in precomputed form, see to_precomputed().
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element mixed_add(const precomputed_type &other) const {
+                            return precomputed_addition_processor::process(*this, other);
                         }
                     };
 
@@ -0,0 +1,205 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_TWISTED_HESSIAN_G1_ELEMENT_PROJECTIVE_HPP
+#define CRYPTO3_ALGEBRA_CURVES_TWISTED_HESSIAN_G1_ELEMENT_PROJECTIVE_HPP
+
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/inplace_arithmetic.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_hessian/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_hessian/projective/add_2015_bckl.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_hessian/projective/dbl_2015_bckl.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_hessian/projective/madd_2015_bckl.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing a group G1 of elliptic curve.
+                     *    @tparam CurveParams Parameters of the group
+                     *    @tparam Form Form of the curve
+                     *    @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    struct curve_element;
+
+                    /** @brief A struct representing an element from the group G1 of twisted Hessian curve
+                     *  a*X^3 + Y^3 + Z^3 = d*X*Y*Z of projective coordinates representation.
+                     *  Description: https://hyperelliptic.org/EFD/g1p/auto-twistedhessian.html
+                     *
+                     */
+                    template<typename CurveParams>
+                    struct curve_element<CurveParams, forms::twisted_hessian, coordinates::projective>
+                        : public inplace_arithmetic<curve_element<CurveParams, forms::twisted_hessian, coordinates::projective>> {
+
+                        using params_type = CurveParams;
+                        using field_type = typename params_type::field_type;
+
+                    private:
+                        using field_value_type = typename field_type::value_type;
+
+                        using common_addition_processor = twisted_hessian_element_g1_projective_add_2015_bckl;
+                        using common_doubling_processor = twisted_hessian_element_g1_projective_dbl_2015_bckl;
+                        using mixed_addition_processor = twisted_hessian_element_g1_projective_madd_2015_bckl;
+
+                    public:
+                        using form = forms::twisted_hessian;
+                        using coordinates = coordinates::projective;
+
+                        using group_type = typename params_type::template group_type<coordinates>;
+
+                        field_value_type X;
+                        field_value_type Y;
+                        field_value_type Z;
+
+                        /*************************  Constructors and zero/one  ***********************************/
+
+                        /** @brief
+                         *    @return the point at infinity by default
+                         *
+                         */
+                        constexpr curve_element() :
+                            curve_element(field_value_type::zero(),
+                                          -field_value_type::one(),
+                                          field_value_type::one()) {};
+
+                        /** @brief
+                         *    @return the selected point (X:Y:Z)
+                         *
+                         */
+                        constexpr curve_element(field_value_type X, field_value_type Y, field_value_type Z) {
+                            this->X = X;
+                            this->Y = Y;
+                            this->Z = Z;
+                        };
+
+                        /** @brief Get the point at infinity
+                         *
+                         */
+                        constexpr static curve_element zero() {
+                            return curve_element();
+                        }
+
+                        /** @brief Get the generator of group G1
+                         *
+                         */
+                        constexpr static curve_element one() {
+                            return curve_element(params_type::one_fill[0], params_type::one_fill[1],
+                                                 field_value_type::one());
+                        }
+
+                        /*************************  Comparison operations  ***********************************/
+
+                        constexpr bool operator==(const curve_element &other) const {
+                            // points at infinity Z = 0 are regular points of the curve, so all three ratios are
+                            // compared
+                            return (this->X * other.Y) == (other.X * this->Y) &&
+                                   (this->X * other.Z) == (other.X * this->Z) &&
+                                   (this->Y * other.Z) == (other.Y * this->Z);
+                        }
+
+                        constexpr bool operator!=(const curve_element &other) const {
+                            return !(operator==(other));
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 is the point at infinity
+                         */
+                        constexpr bool is_zero() const {
+                            // the neutral element is (0:-1:1)
+                            return this->X.is_zero() && this->Y == -this->Z;
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 lies on the elliptic curve
+                         *
+                         * A check, that a*X^3 + Y^3 + Z^3 = d*X*Y*Z
+                         */
+                        constexpr bool is_well_formed() const {
+                            return !(this->X.is_zero() && this->Y.is_zero() && this->Z.is_zero()) &&
+                                   field_value_type(params_type::a) * this->X.squared() * this->X +
+                                           this->Y.squared() * this->Y + this->Z.squared() * this->Z ==
+                                       field_value_type(params_type::d) * this->X * this->Y * this->Z;
+                        }
+
+                        /*************************  Arithmetic operations  ***********************************/
+
+                        constexpr curve_element &operator=(const curve_element &other) {
+                            // handle special cases having to do with O
+                            this->X = other.X;
+                            this->Y = other.Y;
+                            this->Z = other.Z;
+
+                            return *this;
+                        }
+
+                        /** @brief
+                         *
+                         * The rotated addition law is complete for a non-cube a: it doubles and handles O
+                         * without branching on them.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element operator+(const curve_element &other) const {
+                            return common_addition_processor::process(*this, other);
+                        }
+
+                        constexpr curve_element operator-() const {
+                            return curve_element(X, Z, Y);
+                        }
+
+                        constexpr curve_element operator-(const curve_element &other) const {
+                            return (*this) + (-other);
+                        }
+
+                        /** @brief
+                         *
+                         * @return doubled element from group G1
+                         */
+                        constexpr curve_element doubled() const {
+                            return common_doubling_processor::process(*this);
+                        }
+
+                        /** @brief
+                         *
+                         * “Mixed addition” refers to the case Z2 known to be 1.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr curve_element mixed_add(const curve_element &other) const {
+                            // O = (0:-1:1) has Z = 1 too, so it needs no branch either
+                            return mixed_addition_processor::process(*this, other);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_TWISTED_HESSIAN_G1_ELEMENT_PROJECTIVE_HPP
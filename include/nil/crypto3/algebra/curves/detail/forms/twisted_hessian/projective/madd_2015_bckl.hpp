@@ -0,0 +1,63 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_TWISTED_HESSIAN_G1_ELEMENT_PROJECTIVE_MADD_2015_BCKL_HPP
+#define CRYPTO3_ALGEBRA_CURVES_TWISTED_HESSIAN_G1_ELEMENT_PROJECTIVE_MADD_2015_BCKL_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing element mixed addition from the group G1 of twisted Hessian curve
+                     *  for projective coordinates representation, assuming Z2=1.
+                     */
+                    struct twisted_hessian_element_g1_projective_madd_2015_bckl {
+
+                        template<typename ElementType>
+                        constexpr static inline ElementType process(const ElementType &first,
+                                                                    const ElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+                            using params_type = typename ElementType::params_type;
+
+                            field_value_type C = first.Y * second.X;                     // C = Y1*X2
+                            field_value_type D = first.Y * second.Y;                     // D = Y1*Y2
+                            field_value_type E = first.Z * second.Y;                     // E = Z1*Y2
+                            field_value_type F = first.X * second.X * params_type::a;    // F = a*X1*X2
+                            field_value_type X3 = first.X * first.Z - C * D;             // X3 = X1*Z1-C*D
+                            field_value_type Y3 = D * E - F * first.X;                   // Y3 = D*E-F*X1
+                            field_value_type Z3 = F * C - first.Z * E;                   // Z3 = F*C-Z1*E
+
+                            return ElementType(X3, Y3, Z3);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_TWISTED_HESSIAN_G1_ELEMENT_PROJECTIVE_MADD_2015_BCKL_HPP
@@ -0,0 +1,54 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_GLV_HPP
+#define CRYPTO3_ALGEBRA_CURVES_GLV_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief Endomorphism phi of a group with parameters CurveParams which acts on its prime-order
+                     * subgroup as multiplication by some lambda, for the method of Gallant, Lambert and Vanstone:
+                     * k * P = k1 * P + k2 * phi(P) with |k1|, |k2| of about half the bit length of k.
+                     * Curves with such an endomorphism specialize the policy with value = true, a static phi(P)
+                     * and a static decompose(k) returning the signed pair (k1, k2).
+                     *    @tparam CurveParams Parameters of the group
+                     *
+                     */
+                    template<typename CurveParams>
+                    struct glv_endomorphism_policy {
+                        constexpr static const bool value = false;
+                    };
+
+                    template<typename CurveParams>
+                    constexpr bool const glv_endomorphism_policy<CurveParams>::value;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_GLV_HPP
@@ -31,6 +31,7 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
 
 #include <type_traits>
+#include <vector>
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
@@ -74,6 +75,33 @@ namespace nil {
                             group_value_type Q1 = map_to_curve<GroupType>::process(u[1]);
                             return clear_cofactor(Q0 + Q1);
                         }
+
+                        // Hashes every message of msgs with the same dst. Expansion and mapping run over the
+                        // whole batch first, so the map shares its field inversions where it has any (SvdW; the
+                        // SSWU maps are inversion-free). Cofactor clearing still runs per point on the Jacobian
+                        // sums, and the results are left unnormalized, exactly as hash_to_curve returns them.
+                        template<typename InputRange, typename DstType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputRange::value_type::value_type>::value &&
+                                     std::is_same<std::uint8_t, typename DstType::value_type>::value>::type>
+                        static inline std::vector<group_value_type> hash_to_curve_batch(const InputRange &msgs,
+                                                                                         const DstType &dst) {
+                            std::vector<field_value_type> us;
+                            for (const auto &msg : msgs) {
+                                auto u = hash_to_field<2, expand_message_ro>(msg, dst);
+                                us.emplace_back(u[0]);
+                                us.emplace_back(u[1]);
+                            }
+
+                            std::vector<group_value_type> Qs = map_to_curve<GroupType>::process_batch(us);
+
+                            std::vector<group_value_type> result;
+                            result.reserve(Qs.size() / 2);
+                            for (std::size_t i = 0; i < Qs.size(); i += 2) {
+                                result.emplace_back(clear_cofactor(Qs[i] + Qs[i + 1]));
+                            }
+                            return result;
+                        }
                         // private:
                         template<std::size_t N, typename expand_message_type, typename InputType, typename DstType,
                                  typename = typename std::enable_if<
@@ -101,7 +129,7 @@ namespace nil {
                         }
 
                         static inline group_value_type clear_cofactor(const group_value_type &R) {
-                            return R * suite_type::h_eff;
+                            return suite_type::clear_cofactor(R);
                         }
                     };
                 }    // namespace detail
@@ -40,6 +40,7 @@
 #include <boost/static_assert.hpp>
 #include <boost/concept/assert.hpp>
 
+#include <algorithm>
 #include <array>
 #include <type_traits>
 #include <iterator>
@@ -88,74 +89,51 @@ namespace nil {
                             const std::array<std::uint8_t, 2> l_i_b_str = {
                                 static_cast<std::uint8_t>(len_in_bytes >> 8u),
                                 static_cast<std::uint8_t>(len_in_bytes % 0x100)};
+                            const std::array<std::uint8_t, 1> dst_len_str = {
+                                static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end()))};
                             const std::size_t ell = static_cast<std::size_t>(len_in_bytes / b_in_bytes) +
                                                     static_cast<std::size_t>(len_in_bytes % b_in_bytes != 0);
 
                             // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
                             BOOST_ASSERT(ell <= 255);
 
-                            // TODO: use accumulators when they will be fixed
-                            // accumulator_set<HashType> b0_acc;
-                            // hash<HashType>(Z_pad, b0_acc);
-                            // hash<HashType>(msg, b0_acc);
-                            // hash<HashType>(l_i_b_str, b0_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {0}, b0_acc);
-                            // hash<HashType>(dst, b0_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                            // b0_acc); typename HashType::digest_type b0 =
-                            // accumulators::extract::hash<HashType>(b0_acc);
-                            std::vector<std::uint8_t> msg_prime;
-                            msg_prime.insert(msg_prime.end(), Z_pad.begin(), Z_pad.end());
-                            msg_prime.insert(msg_prime.end(), msg.begin(), msg.end());
-                            msg_prime.insert(msg_prime.end(), l_i_b_str.begin(), l_i_b_str.end());
-                            msg_prime.insert(msg_prime.end(), static_cast<std::uint8_t>(0));
-                            msg_prime.insert(msg_prime.end(), dst.begin(), dst.end());
-                            msg_prime.insert(msg_prime.end(),
-                                             static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                            typename HashType::digest_type b0 = hash<HashType>(msg_prime);
-
-                            // TODO: use accumulators when they will be fixed
-                            // accumulator_set<HashType> bi_acc;
-                            // hash<HashType>(b0, bi_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {1}, bi_acc);
-                            // hash<HashType>(dst, bi_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                            // bi_acc); typename HashType::digest_type bi =
-                            // accumulators::extract::hash<HashType>(bi_acc); std::copy(bi.begin(), bi.end(),
-                            // uniform_bytes.begin());
-                            std::vector<std::uint8_t> b_i_str;
-                            b_i_str.insert(b_i_str.end(), b0.begin(), b0.end());
-                            b_i_str.insert(b_i_str.end(), static_cast<std::uint8_t>(1));
-                            b_i_str.insert(b_i_str.end(), dst.begin(), dst.end());
-                            b_i_str.insert(b_i_str.end(),
-                                           static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                            typename HashType::digest_type bi = hash<HashType>(b_i_str);
-                            std::copy(bi.begin(), bi.end(), uniform_bytes.begin());
-
+                            // b_0 = H(Z_pad || msg || l_i_b_str || I2OSP(0, 1) || DST_prime)
+                            accumulator_set<HashType> b0_acc;
+                            hash<HashType>(Z_pad, b0_acc);
+                            hash<HashType>(msg, b0_acc);
+                            hash<HashType>(l_i_b_str, b0_acc);
+                            hash<HashType>(std::array<std::uint8_t, 1> {0}, b0_acc);
+                            hash<HashType>(dst, b0_acc);
+                            hash<HashType>(dst_len_str, b0_acc);
+                            const typename HashType::digest_type b0 = accumulators::extract::hash<HashType>(b0_acc);
+
+                            // b_1 = H(b_0 || I2OSP(1, 1) || DST_prime)
+                            // b_i = H(strxor(b_0, b_(i - 1)) || I2OSP(i, 1) || DST_prime)
+                            typename HashType::digest_type bi;
                             typename HashType::digest_type xored_b;
-                            for (std::size_t i = 2; i <= ell; i++) {
-                                // TODO: use accumulators when they will be fixed
-                                // accumulator_set<HashType> bi_acc;
-                                // strxor(b0, bi, xored_b);
-                                // hash<HashType>(xored_b, bi_acc);
-                                // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(i)}, bi_acc);
-                                // hash<HashType>(dst, bi_acc);
-                                // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                                //                bi_acc);
-                                // bi = accumulators::extract::hash<HashType>(bi_acc);
-                                // std::copy(bi.begin(), bi.end(), uniform_bytes.begin() + (i - 1) * b_in_bytes);
-                                strxor(b0, bi, xored_b);
-                                std::vector<std::uint8_t> b_i_str;
-                                b_i_str.insert(b_i_str.end(), xored_b.begin(), xored_b.end());
-                                b_i_str.insert(b_i_str.end(), static_cast<std::uint8_t>(i));
-                                b_i_str.insert(b_i_str.end(), dst.begin(), dst.end());
-                                b_i_str.insert(b_i_str.end(),
-                                               static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                                bi = hash<HashType>(b_i_str);
-                                std::copy(bi.begin(), bi.end(), uniform_bytes.begin() + (i - 1) * b_in_bytes);
+                            auto out = uniform_bytes.begin();
+                            for (std::size_t i = 1; i <= ell; i++) {
+                                accumulator_set<HashType> bi_acc;
+                                if (i == 1) {
+                                    hash<HashType>(b0, bi_acc);
+                                } else {
+                                    strxor(b0, bi, xored_b);
+                                    hash<HashType>(xored_b, bi_acc);
+                                }
+                                hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(i)}, bi_acc);
+                                hash<HashType>(dst, bi_acc);
+                                hash<HashType>(dst_len_str, bi_acc);
+                                bi = accumulators::extract::hash<HashType>(bi_acc);
+
+                                const std::size_t chunk = std::min(b_in_bytes, len_in_bytes - (i - 1) * b_in_bytes);
+                                out = std::copy(bi.begin(), bi.begin() + chunk, out);
                             }
                         }
                     };
+
+                    template<std::size_t k, typename HashType, typename Enable>
+                    constexpr std::array<std::uint8_t, expand_message_xmd<k, HashType, Enable>::r_in_bytes> const
+                        expand_message_xmd<k, HashType, Enable>::Z_pad;
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
@@ -31,6 +31,7 @@
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 
 #include <array>
+#include <cstddef>
 
 namespace nil {
     namespace crypto3 {
@@ -40,6 +41,55 @@ namespace nil {
                     template<typename GroupType>
                     struct iso_map;
 
+                    // {1, z, z^2, ..., z^(N - 1)}
+                    template<std::size_t N, typename FieldValueType>
+                    inline std::array<FieldValueType, N> iso_map_powers(const FieldValueType &z) {
+                        std::array<FieldValueType, N> result;
+                        result[0] = FieldValueType::one();
+                        for (std::size_t i = 1; i < N; i++) {
+                            result[i] = result[i - 1] * z;
+                        }
+                        return result;
+                    }
+
+                    /*
+                     * Homogeneous Horner evaluation of sum_i k[i] * x_num^i * x_den^(D - i), i.e. x_den^D * P(x_num / x_den)
+                     * for the degree D polynomial P with coefficients k. A monic P has its leading 1 omitted from k,
+                     * as in the draft's tables. x_den_powers[j] must hold x_den^j for j <= D.
+                     */
+                    template<typename FieldValueType, std::size_t N, std::size_t M>
+                    inline FieldValueType iso_map_horner(const std::array<FieldValueType, N> &k, bool monic,
+                                                         const FieldValueType &x_num,
+                                                         const std::array<FieldValueType, M> &x_den_powers) {
+                        const std::size_t degree = monic ? N : N - 1;
+                        FieldValueType result = monic ? FieldValueType::one() : k[degree];
+                        for (std::size_t i = degree; i-- > 0;) {
+                            result = result * x_num + k[i] * x_den_powers[degree - i];
+                        }
+                        return result;
+                    }
+
+                    /*
+                     * Assembles the image of the Jacobian point ci from the homogenized polynomials at x = X / Z^2.
+                     * The isogenies of the draft have deg x_num = deg x_den + 1 and deg y_num = deg y_den, so
+                     * x' = x_num / (x_den * Z^2) and y' = Y * y_num / (y_den * Z^3). The result has
+                     * Z' = x'_den * y'_den and needs no inversion; it is the identity if a denominator vanishes.
+                     */
+                    template<typename GroupValueType, typename FieldValueType>
+                    inline GroupValueType iso_map_jacobian(const GroupValueType &ci, const FieldValueType &x_num,
+                                                           const FieldValueType &x_den, const FieldValueType &y_num,
+                                                           const FieldValueType &y_den) {
+                        const FieldValueType zz = ci.Z.squared();
+                        const FieldValueType b = x_den * zz;
+                        const FieldValueType d = y_den * zz * ci.Z;
+                        if (b.is_zero() || d.is_zero()) {
+                            return GroupValueType::zero();
+                        }
+                        const FieldValueType bd = b * d;
+                        const FieldValueType bdd = bd * d;
+                        return GroupValueType(x_num * bdd, ci.Y * y_num * b.squared() * bdd, bd);
+                    }
+
                     // 11-isogeny map for BLS12-381 G1
                     // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#appendix-E.2
                     template<>
@@ -113,44 +163,42 @@ namespace nil {
                             0x2660400eb2e4f3b628bdd0d53cd76f2bf565b94e72927c1cb748df27942480e420517bd8714cc80d1fadc1326ed06f7_cppui381,
                             0xe0fa1d816ddc03e6b24255e0d7819c171c40f65e273b853324efcd6356caa205ca2f570f13497804415473a1d634b8f_cppui381};
 
-                    public:
-                        static inline group_value_type process(const group_value_type &ci) {
-                            field_value_type x_num = field_value_type::zero();
-                            field_value_type x_den = field_value_type::zero();
-                            field_value_type y_num = field_value_type::zero();
-                            field_value_type y_den = field_value_type::zero();
-
-                            std::vector<field_value_type> xi_powers = [&ci]() {
-                                std::vector<field_value_type> xi_powers {field_value_type::one()};
+                        struct coefficients_type {
+                            std::array<field_value_type, 12> x_num;
+                            std::array<field_value_type, 10> x_den;
+                            std::array<field_value_type, 16> y_num;
+                            std::array<field_value_type, 15> y_den;
+                        };
+
+                        // k_* converted to field elements once
+                        static const coefficients_type &coefficients() {
+                            static const coefficients_type k = []() {
+                                coefficients_type result;
+                                for (std::size_t i = 0; i < 12; i++) {
+                                    result.x_num[i] = field_value_type(k_x_num[i]);
+                                }
+                                for (std::size_t i = 0; i < 10; i++) {
+                                    result.x_den[i] = field_value_type(k_x_den[i]);
+                                }
+                                for (std::size_t i = 0; i < 16; i++) {
+                                    result.y_num[i] = field_value_type(k_y_num[i]);
+                                }
                                 for (std::size_t i = 0; i < 15; i++) {
-                                    xi_powers.emplace_back(xi_powers.back() * ci.X);
+                                    result.y_den[i] = field_value_type(k_y_den[i]);
                                 }
-                                return xi_powers;
+                                return result;
                             }();
+                            return k;
+                        }
 
-                            for (std::size_t i = 0; i < k_x_den.size(); i++) {
-                                x_den += field_value_type(k_x_den[i]) * xi_powers[i];
-                            }
-                            x_den += xi_powers[k_x_den.size()];
-
-                            for (std::size_t i = 0; i < k_y_den.size(); i++) {
-                                y_den += field_value_type(k_y_den[i]) * xi_powers[i];
-                            }
-                            y_den += xi_powers[k_y_den.size()];
-
-                            if (x_den.is_zero() || y_den.is_zero()) {
-                                return group_value_type::one();
-                            }
-
-                            for (std::size_t i = 0; i < k_x_num.size(); i++) {
-                                x_num += field_value_type(k_x_num[i]) * xi_powers[i];
-                            }
-
-                            for (std::size_t i = 0; i < k_y_num.size(); i++) {
-                                y_num += field_value_type(k_y_num[i]) * xi_powers[i];
-                            }
-
-                            return group_value_type(x_num / x_den, ci.Y * y_num / y_den, field_value_type::one());
+                    public:
+                        static inline group_value_type process(const group_value_type &ci) {
+                            const coefficients_type &k = coefficients();
+                            const std::array<field_value_type, 16> zz_powers = iso_map_powers<16>(ci.Z.squared());
+                            return iso_map_jacobian(ci, iso_map_horner(k.x_num, false, ci.X, zz_powers),
+                                                    iso_map_horner(k.x_den, true, ci.X, zz_powers),
+                                                    iso_map_horner(k.y_num, false, ci.X, zz_powers),
+                                                    iso_map_horner(k.y_den, true, ci.X, zz_powers));
                         }
                     };
 
@@ -200,46 +248,169 @@ namespace nil {
                              {{0x12,
                                0x1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaa99_cppui381}}}};
 
+                        struct coefficients_type {
+                            std::array<field_value_type, 4> x_num;
+                            std::array<field_value_type, 2> x_den;
+                            std::array<field_value_type, 4> y_num;
+                            std::array<field_value_type, 3> y_den;
+                        };
+
+                        // k_* converted to field elements once
+                        static const coefficients_type &coefficients() {
+                            static const coefficients_type k = []() {
+                                coefficients_type result;
+                                for (std::size_t i = 0; i < 4; i++) {
+                                    result.x_num[i] = field_value_type(k_x_num[i][0], k_x_num[i][1]);
+                                }
+                                for (std::size_t i = 0; i < 2; i++) {
+                                    result.x_den[i] = field_value_type(k_x_den[i][0], k_x_den[i][1]);
+                                }
+                                for (std::size_t i = 0; i < 4; i++) {
+                                    result.y_num[i] = field_value_type(k_y_num[i][0], k_y_num[i][1]);
+                                }
+                                for (std::size_t i = 0; i < 3; i++) {
+                                    result.y_den[i] = field_value_type(k_y_den[i][0], k_y_den[i][1]);
+                                }
+                                return result;
+                            }();
+                            return k;
+                        }
+
                     public:
                         static inline group_value_type process(const group_value_type &ci) {
-                            field_value_type x_num = field_value_type::zero();
-                            field_value_type x_den = field_value_type::zero();
-                            field_value_type y_num = field_value_type::zero();
-                            field_value_type y_den = field_value_type::zero();
+                            const coefficients_type &k = coefficients();
+                            const std::array<field_value_type, 4> zz_powers = iso_map_powers<4>(ci.Z.squared());
+                            return iso_map_jacobian(ci, iso_map_horner(k.x_num, false, ci.X, zz_powers),
+                                                    iso_map_horner(k.x_den, true, ci.X, zz_powers),
+                                                    iso_map_horner(k.y_num, false, ci.X, zz_powers),
+                                                    iso_map_horner(k.y_den, true, ci.X, zz_powers));
+                        }
+                    };
+
+                    /*
+                     * Horner evaluation for the 3-isogenies whose coefficients lie in the prime field. Derived lists the
+                     * draft's k_x_num, k_x_den, k_y_num and k_y_den tables as integral constants.
+                     */
+                    template<typename Derived, typename GroupType>
+                    class iso_map_3_fp {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
 
-                            std::vector<field_value_type> xi_powers = [&ci]() {
-                                std::vector<field_value_type> xi_powers {field_value_type::one()};
+                        struct coefficients_type {
+                            std::array<field_value_type, 4> x_num;
+                            std::array<field_value_type, 2> x_den;
+                            std::array<field_value_type, 4> y_num;
+                            std::array<field_value_type, 3> y_den;
+                        };
+
+                        static const coefficients_type &coefficients() {
+                            static const coefficients_type k = []() {
+                                coefficients_type result;
+                                for (std::size_t i = 0; i < 4; i++) {
+                                    result.x_num[i] = field_value_type(Derived::k_x_num[i]);
+                                    result.y_num[i] = field_value_type(Derived::k_y_num[i]);
+                                }
+                                for (std::size_t i = 0; i < 2; i++) {
+                                    result.x_den[i] = field_value_type(Derived::k_x_den[i]);
+                                }
                                 for (std::size_t i = 0; i < 3; i++) {
-                                    auto v = xi_powers.back();
-                                    xi_powers.emplace_back(xi_powers.back() * ci.X);
+                                    result.y_den[i] = field_value_type(Derived::k_y_den[i]);
                                 }
-                                return xi_powers;
+                                return result;
                             }();
+                            return k;
+                        }
+
+                    public:
+                        static inline group_value_type process(const group_value_type &ci) {
+                            const coefficients_type &k = coefficients();
+                            const std::array<field_value_type, 4> zz_powers = iso_map_powers<4>(ci.Z.squared());
+                            return iso_map_jacobian(ci, iso_map_horner(k.x_num, false, ci.X, zz_powers),
+                                                    iso_map_horner(k.x_den, true, ci.X, zz_powers),
+                                                    iso_map_horner(k.y_num, false, ci.X, zz_powers),
+                                                    iso_map_horner(k.y_den, true, ci.X, zz_powers));
+                        }
+                    };
 
-                            for (std::size_t i = 0; i < k_x_den.size(); i++) {
-                                x_den += field_value_type(k_x_den[i][0], k_x_den[i][1]) * xi_powers[i];
-                            }
-                            x_den += xi_powers[k_x_den.size()];
+                    // 3-isogeny map from iso-Pallas to Pallas
+                    template<>
+                    class iso_map<typename pallas::g1_type<>>
+                        : public iso_map_3_fp<iso_map<typename pallas::g1_type<>>, typename pallas::g1_type<>> {
+                        typedef typename pallas::g1_type<>::field_type::integral_type integral_type;
 
-                            for (std::size_t i = 0; i < k_y_den.size(); i++) {
-                                y_den += field_value_type(k_y_den[i][0], k_y_den[i][1]) * xi_powers[i];
-                            }
-                            y_den += xi_powers[k_y_den.size()];
+                    public:
+                        constexpr static std::array<integral_type, 4> k_x_num = {
+                            0x1c71c71c71c71c71c71c71c71c71c71c8102eea8e7b06eb6eebec06955555580_cppui255,
+                            0x17329b9ec525375398c7d7ac3d98fd13380af066cfeb6d690eb64faef37ea4f7_cppui255,
+                            0x3509afd51872d88e267c7ffa51cf412a0f93b82ee4b994958cf863b02814fb76_cppui255,
+                            0xe38e38e38e38e38e38e38e38e38e38e4081775473d8375b775f6034aaaaaaab_cppui255};
+                        constexpr static std::array<integral_type, 2> k_x_den = {
+                            0x325669becaecd5d11d13bf2a7f22b105b4abf9fb9a1fc81c2aa3af1eae5b6604_cppui255,
+                            0x1d572e7ddc099cff5a607fcce0494a799c434ac1c96b6980c47f2ab668bcd71f_cppui255};
+                        constexpr static std::array<integral_type, 4> k_y_num = {
+                            0x25ed097b425ed097b425ed097b425ed0ac03e8e134eb3e493e53ab371c71c4f_cppui255,
+                            0x3fb98ff0d2ddcadd303216cce1db9ff11765e924f745937802e2be87d225b234_cppui255,
+                            0x1a84d7ea8c396c47133e3ffd28e7a09507c9dc17725cca4ac67c31d8140a7dbb_cppui255,
+                            0x1a12f684bda12f684bda12f684bda12f7642b01ad461bad25ad985b5e38e38e4_cppui255};
+                        constexpr static std::array<integral_type, 3> k_y_den = {
+                            0x40000000000000000000000000000000224698fc094cf91b992d30ecfffffde5_cppui255,
+                            0x17033d3c60c68173573b3d7f7d681310d976bbfabbc5661d4d90ab820b12320a_cppui255,
+                            0xc02c5bcca0e6b7f0790bfb3506defb65941a3a4a97aa1b35a28279b1d1b42ae_cppui255};
+                    };
 
-                            if (x_den.is_zero() || y_den.is_zero()) {
-                                return group_value_type::one();
-                            }
+                    // 3-isogeny map from iso-Vesta to Vesta
+                    template<>
+                    class iso_map<typename vesta::g1_type<>>
+                        : public iso_map_3_fp<iso_map<typename vesta::g1_type<>>, typename vesta::g1_type<>> {
+                        typedef typename vesta::g1_type<>::field_type::integral_type integral_type;
 
-                            for (std::size_t i = 0; i < k_x_num.size(); i++) {
-                                x_num += field_value_type(k_x_num[i][0], k_x_num[i][1]) * xi_powers[i];
-                            }
+                    public:
+                        constexpr static std::array<integral_type, 4> k_x_num = {
+                            0x31c71c71c71c71c71c71c71c71c71c71e1c521a795ac8356fb539a6f0000002b_cppui255,
+                            0x18760c7f7a9ad20ded7ee4a9cdf78f8fd59d03d23b39cb11aeac67bbeb586a3d_cppui255,
+                            0x1d935247b4473d17acecf10f5f7c09a2216b8861ec72bd5d8b95c6aaf703bcc5_cppui255,
+                            0x38e38e38e38e38e38e38e38e38e38e390205dd51cfa0961a43cd42c800000001_cppui255};
+                        constexpr static std::array<integral_type, 2> k_x_den = {
+                            0x14735171ee5427780c621de8b91c242a30cd6d53df49d235f169c187d2533465_cppui255,
+                            0xa2de485568125d51454798a5b5c56b2a3ad678129b604d3b7284f7eaf21a2e9_cppui255};
+                        constexpr static std::array<integral_type, 4> k_y_num = {
+                            0x1ed097b425ed097b425ed097b425ed098bc32d36fb21a6a38f64842c55555533_cppui255,
+                            0x19b0d87e16e2578866d1466e9de10e6497a3ca5c24e9ea634986913ab4443034_cppui255,
+                            0x2ec9a923da239e8bd6767887afbe04d121d910aefb03b31d8bee58e5fb81de63_cppui255,
+                            0x12f684bda12f684bda12f684bda12f685601f4709a8adcb36bef1642aaaaaaab_cppui255};
+                        constexpr static std::array<integral_type, 3> k_y_den = {
+                            0x40000000000000000000000000000000224698fc0994a8dd8c46eb20fffffde5_cppui255,
+                            0x3d59f455cafc7668252659ba2b546c7e926847fb9ddd76a1d43d449776f99d2f_cppui255,
+                            0x2f44d6c801c1b8bf9e7eb64f890a820c06a767bfc35b5bac58dfecce86b2745e_cppui255};
+                    };
 
-                            for (std::size_t i = 0; i < k_y_num.size(); i++) {
-                                y_num += field_value_type(k_y_num[i][0], k_y_num[i][1]) * xi_powers[i];
-                            }
+                    // 3-isogeny map for secp256k1
+                    // https://datatracker.ietf.org/doc/html/rfc9380#appendix-E.1
+                    template<>
+                    class iso_map<typename secp256k1::g1_type<>>
+                        : public iso_map_3_fp<iso_map<typename secp256k1::g1_type<>>, typename secp256k1::g1_type<>> {
+                        typedef typename secp256k1::g1_type<>::field_type::integral_type integral_type;
 
-                            return group_value_type(x_num / x_den, ci.Y * y_num / y_den, field_value_type::one());
-                        }
+                    public:
+                        constexpr static std::array<integral_type, 4> k_x_num = {
+                            0x8e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38daaaaa8c7_cppui256,
+                            0x7d3d4c80bc321d5b9f315cea7fd44c5d595d2fc0bf63b92dfff1044f17c6581_cppui256,
+                            0x534c328d23f234e6e2a413deca25caece4506144037c40314ecbd0b53d9dd262_cppui256,
+                            0x8e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38daaaaa88c_cppui256};
+                        constexpr static std::array<integral_type, 2> k_x_den = {
+                            0xd35771193d94918a9ca34ccbb7b640dd86cd409542f8487d9fe6b745781eb49b_cppui256,
+                            0xedadc6f64383dc1df7c4b2d51b54225406d36b641f5e41bbc52a56612a8c6d14_cppui256};
+                        constexpr static std::array<integral_type, 4> k_y_num = {
+                            0x4bda12f684bda12f684bda12f684bda12f684bda12f684bda12f684b8e38e23c_cppui256,
+                            0xc75e0c32d5cb7c0fa9d0a54b12a0a6d5647ab046d686da6fdffc90fc201d71a3_cppui256,
+                            0x29a6194691f91a73715209ef6512e576722830a201be2018a765e85a9ecee931_cppui256,
+                            0x2f684bda12f684bda12f684bda12f684bda12f684bda12f684bda12f38e38d84_cppui256};
+                        constexpr static std::array<integral_type, 3> k_y_den = {
+                            0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffff93b_cppui256,
+                            0x7a06534bb8bdb49fd5e9e6632722c2989467c1bfc8e8d978dfb425d2685c2573_cppui256,
+                            0x6484aa716545ca2cf3a70c3fa8fe337e0a3d21162f0d6299a7bf8192bfd2a76f_cppui256};
                     };
                 }    // namespace detail
             }        // namespace curves
@@ -29,9 +29,16 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_iso_map.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_sgn0.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_sqrt_ratio.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 
+#include <nil/crypto3/algebra/algorithms/batch_inversion.hpp>
+
+#include <array>
+#include <utility>
+#include <vector>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
@@ -44,7 +51,20 @@ namespace nil {
                         typedef typename suite_type::group_value_type group_value_type;
                         typedef typename suite_type::field_value_type field_value_type;
 
+                        /*
+                         * Returns the Jacobian point (x_num * x_den, y * x_den^3, x_den) so that the map itself
+                         * needs no inversion.
+                         */
                         static inline group_value_type process(const field_value_type &u) {
+                            const std::array<field_value_type, 3> e = evaluate(u);
+                            return group_value_type(e[0] * e[1], e[2] * e[1].squared() * e[1], e[1]);
+                        }
+
+                        /*
+                         * Straight-line simplified SWU returning {x_num, x_den, y} with x = x_num / x_den.
+                         * https://datatracker.ietf.org/doc/html/draft-irtf-cfrg-hash-to-curve-16#appendix-F.2
+                         */
+                        static inline std::array<field_value_type, 3> evaluate(const field_value_type &u) {
                             // TODO: We assume that Z meets the following criteria -- correct for predefined suites,
                             //  but wrong in general case
                             // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-6.6.2
@@ -53,29 +73,29 @@ namespace nil {
                             // 2.  Z != -1 in F,
                             // 3.  the polynomial g(x) - Z is irreducible over F, and
                             // 4.  g(B / (Z * A)) is square in F.
-                            static const field_value_type one = field_value_type::one();
+                            const field_value_type &A = suite_type::Ai;
+                            const field_value_type &B = suite_type::Bi;
+                            const field_value_type &Z = suite_type::Z;
 
-                            field_value_type tv1 =
-                                (suite_type::Z.pow(2) * u.pow(4) + suite_type::Z * u.pow(2)).inversed();
-                            field_value_type x1 = (-suite_type::Bi / suite_type::Ai) * (one + tv1);
-                            if (tv1.is_zero()) {
-                                x1 = suite_type::Bi / (suite_type::Z * suite_type::Ai);
-                            }
-                            field_value_type gx1 = x1.pow(3) + suite_type::Ai * x1 + suite_type::Bi;
-                            field_value_type x2 = suite_type::Z * u.pow(2) * x1;
-                            field_value_type gx2 = x2.pow(3) + suite_type::Ai * x2 + suite_type::Bi;
-                            field_value_type x, y;
-                            if (gx1.is_square()) {
-                                x = x1;
-                                y = gx1.sqrt();
-                            } else {
-                                x = x2;
-                                y = gx2.sqrt();
-                            }
-                            if (sgn0(u) != sgn0(y)) {
-                                y = -y;
-                            }
-                            return group_value_type(x, y, one);
+                            field_value_type tv1 = Z * u.squared();
+                            field_value_type tv2 = tv1.squared() + tv1;
+                            field_value_type tv3 = B * (tv2 + field_value_type::one());
+                            const field_value_type tv4 = A * cmov(Z, -tv2, !tv2.is_zero());
+                            field_value_type tv6 = tv4.squared();
+                            // gx1 = tv2 / tv6 with tv2 = tv3^3 + A * tv3 * tv4^2 + B * tv4^3 and tv6 = tv4^3
+                            tv2 = (tv3.squared() + A * tv6) * tv3;
+                            tv6 = tv6 * tv4;
+                            tv2 = tv2 + B * tv6;
+
+                            const std::pair<bool, field_value_type> gx1_sqrt = sqrt_ratio<GroupType>::process(tv2, tv6);
+                            const bool is_gx1_square = gx1_sqrt.first;
+                            const field_value_type &y1 = gx1_sqrt.second;
+
+                            field_value_type x_num = cmov(tv1 * tv3, tv3, is_gx1_square);
+                            field_value_type y = cmov(tv1 * u * y1, y1, is_gx1_square);
+                            y = cmov(-y, y, sgn0(u) == sgn0(y));
+
+                            return {{x_num, tv4, y}};
                         }
                     };
 
@@ -87,8 +107,121 @@ namespace nil {
                         typedef typename suite_type::field_value_type field_value_type;
 
                         static inline group_value_type process(const field_value_type &u) {
-                            group_value_type ci = m2c_simple_swu<GroupType>::process(u);
-                            return iso_map<GroupType>::process(ci);
+                            return iso_map<GroupType>::process(m2c_simple_swu<GroupType>::process(u));
+                        }
+
+                        // Neither the map nor the isogeny inverts, so there is nothing to share: a batch is
+                        // just mapped element-wise
+                        static inline std::vector<group_value_type>
+                            process_batch(const std::vector<field_value_type> &us) {
+                            std::vector<group_value_type> result;
+                            result.reserve(us.size());
+                            for (const field_value_type &u : us) {
+                                result.emplace_back(process(u));
+                            }
+                            return result;
+                        }
+                    };
+
+                    /*
+                     * Shallue-van de Woestijne map for curves where SSWU does not apply (A * B == 0) and no
+                     * convenient isogeny is known.
+                     * https://datatracker.ietf.org/doc/html/rfc9380#appendix-F.1
+                     */
+                    template<typename GroupType>
+                    struct m2c_svdw {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        // g(x) = x^3 + A * x + B
+                        static inline field_value_type g(const field_value_type &x) {
+                            return (x.squared() + suite_type::Ai) * x + suite_type::Bi;
+                        }
+
+                        struct constants_type {
+                            field_value_type c1, c2, c3, c4;
+                        };
+
+                        static const constants_type &constants() {
+                            static const constants_type c = []() {
+                                const field_value_type &A = suite_type::Ai;
+                                const field_value_type &Z = suite_type::Z;
+                                const field_value_type gZ = g(Z);
+                                const field_value_type t = field_value_type(3) * Z.squared() + field_value_type(4) * A;
+
+                                constants_type result;
+                                result.c1 = gZ;
+                                result.c2 = -Z / field_value_type(2);
+                                result.c3 = (-gZ * t).sqrt();
+                                if (sgn0(result.c3)) {
+                                    result.c3 = -result.c3;
+                                }
+                                result.c4 = -field_value_type(4) * gZ / t;
+                                return result;
+                            }();
+                            return c;
+                        }
+
+                        static inline group_value_type process(const field_value_type &u) {
+                            field_value_type tv3 = denominator(u);
+                            // inv0
+                            if (!tv3.is_zero()) {
+                                tv3 = tv3.inversed();
+                            }
+                            return process_with_inverse(u, tv3);
+                        }
+
+                        // The only inversion of the map is shared by the whole batch
+                        static inline std::vector<group_value_type>
+                            process_batch(const std::vector<field_value_type> &us) {
+                            std::vector<field_value_type> inverses;
+                            inverses.reserve(us.size());
+                            for (const field_value_type &u : us) {
+                                inverses.emplace_back(denominator(u));
+                            }
+                            // zeros stay zero, which is inv0
+                            batch_inversion(inverses.begin(), inverses.end(), inverses.begin());
+
+                            std::vector<group_value_type> result;
+                            result.reserve(us.size());
+                            for (std::size_t i = 0; i < us.size(); ++i) {
+                                result.emplace_back(process_with_inverse(us[i], inverses[i]));
+                            }
+                            return result;
+                        }
+
+                    private:
+                        // tv3 = (1 - u^2 * c1) * (1 + u^2 * c1), the value the map inverts
+                        static inline field_value_type denominator(const field_value_type &u) {
+                            const field_value_type tv1 = u.squared() * constants().c1;
+                            const field_value_type one = field_value_type::one();
+                            return (one - tv1) * (one + tv1);
+                        }
+
+                        static inline group_value_type process_with_inverse(const field_value_type &u,
+                                                                            const field_value_type &tv3) {
+                            const constants_type &c = constants();
+                            const field_value_type one = field_value_type::one();
+
+                            field_value_type tv1 = u.squared() * c.c1;
+                            const field_value_type tv2 = one + tv1;
+                            tv1 = one - tv1;
+                            const field_value_type tv4 = u * tv1 * tv3 * c.c3;
+
+                            const field_value_type x1 = c.c2 - tv4;
+                            const bool e1 = g(x1).is_square();
+                            const field_value_type x2 = c.c2 + tv4;
+                            const bool e2 = g(x2).is_square() && !e1;
+                            const field_value_type x3 = (tv2.squared() * tv3).squared() * c.c4 + suite_type::Z;
+
+                            field_value_type x = cmov(x3, x1, e1);
+                            x = cmov(x, x2, e2);
+                            field_value_type y = g(x).sqrt();
+                            y = cmov(-y, y, sgn0(u) == sgn0(y));
+
+                            return group_value_type(x, y, one);
                         }
                     };
 
@@ -102,6 +235,22 @@ namespace nil {
                     template<>
                     struct map_to_curve<typename bls12_381::g2_type<>>
                         : m2c_simple_swu_zeroAB<typename bls12_381::g2_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename alt_bn128_254::g1_type<>>
+                        : m2c_svdw<typename alt_bn128_254::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename pallas::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename pallas::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename vesta::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename vesta::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename secp256k1::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename secp256k1::g1_type<>> { };
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
@@ -0,0 +1,140 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SQRT_RATIO_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SQRT_RATIO_HPP
+
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    // CMOV(a, b, c) of the hash-to-curve draft: b if c is set, a otherwise
+                    template<typename ValueType>
+                    inline ValueType cmov(const ValueType &a, const ValueType &b, bool c) {
+                        return c ? b : a;
+                    }
+
+                    /*
+                     * sqrt_ratio(u, v) for the field of GroupType and the non-square Z of its suite.
+                     * Returns (true, sqrt(u / v)) if u / v is square and (false, sqrt(Z * u / v)) otherwise,
+                     * using a single exponentiation and no inversion.
+                     * https://datatracker.ietf.org/doc/html/draft-irtf-cfrg-hash-to-curve-16#appendix-F.2.1.1
+                     */
+                    template<typename GroupType>
+                    struct sqrt_ratio {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename GroupType::field_type field_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+                        typedef typename field_type::extended_integral_type extended_integral_type;
+
+                        struct constants_type {
+                            // largest c1 such that 2^c1 divides q - 1
+                            std::size_t c1;
+                            // (c2 - 1) / 2, where c2 = (q - 1) / 2^c1
+                            extended_integral_type c3;
+                            // Z^c2
+                            field_value_type c6;
+                            // Z^((c2 + 1) / 2)
+                            field_value_type c7;
+                        };
+
+                        static const constants_type &constants() {
+                            static const constants_type c = []() {
+                                extended_integral_type q = 1;
+                                for (std::size_t i = 0; i < field_type::arity; ++i) {
+                                    q *= extended_integral_type(field_type::modulus);
+                                }
+
+                                constants_type result;
+                                result.c1 = 0;
+                                extended_integral_type c2 = q - 1;
+                                while (!multiprecision::bit_test(c2, 0)) {
+                                    c2 >>= 1;
+                                    ++result.c1;
+                                }
+                                result.c3 = (c2 - 1) >> 1;
+                                result.c6 = suite_type::Z.pow(c2);
+                                result.c7 = suite_type::Z.pow(extended_integral_type((c2 + 1) >> 1));
+                                return result;
+                            }();
+                            return c;
+                        }
+
+                        static inline std::pair<bool, field_value_type> process(const field_value_type &u,
+                                                                                const field_value_type &v) {
+                            const constants_type &c = constants();
+
+                            field_value_type tv1 = c.c6;
+                            // tv2 = v^c4, c4 = 2^c1 - 1
+                            field_value_type tv2 = v;
+                            for (std::size_t i = 1; i < c.c1; ++i) {
+                                tv2 = tv2.squared() * v;
+                            }
+                            field_value_type tv3 = tv2.squared() * v;
+                            field_value_type tv5 = (u * tv3).pow(c.c3) * tv2;
+                            tv2 = tv5 * v;
+                            tv3 = tv5 * u;
+                            field_value_type tv4 = tv3 * tv2;
+                            // tv5 = tv4^c5, c5 = 2^(c1 - 1)
+                            tv5 = tv4;
+                            for (std::size_t i = 1; i < c.c1; ++i) {
+                                tv5 = tv5.squared();
+                            }
+                            const bool is_qr = tv5 == field_value_type::one();
+                            tv2 = tv3 * c.c7;
+                            tv5 = tv4 * tv1;
+                            tv3 = cmov(tv2, tv3, is_qr);
+                            tv4 = cmov(tv5, tv4, is_qr);
+
+                            for (std::size_t k = c.c1; k >= 2; --k) {
+                                tv5 = tv4;
+                                for (std::size_t i = 2; i < k; ++i) {
+                                    tv5 = tv5.squared();
+                                }
+                                const bool e1 = tv5 == field_value_type::one();
+                                tv2 = tv3 * tv1;
+                                tv1 = tv1.squared();
+                                tv5 = tv4 * tv1;
+                                tv3 = cmov(tv2, tv3, e1);
+                                tv4 = cmov(tv5, tv4, e1);
+                            }
+
+                            return std::make_pair(is_qr, tv3);
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SQRT_RATIO_HPP
@@ -26,7 +26,12 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SUITES_HPP
 #define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SUITES_HPP
 
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/detail/bls12/endomorphisms.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
@@ -74,6 +79,11 @@ namespace nil {
                             0x12e2908d11688030018b12e8753eee3b2016c1f0f24f4070a0b9c14fcef35ef55a23215a316ceaa5d1cc48e98e172be0_cppui381);
                         constexpr static inline const field_value_type Z = field_value_type(11);
                         constexpr static integral_type h_eff = 0xd201000000010001_cppui381;
+
+                        // [h_eff]R with h_eff = 1 - z
+                        static inline group_value_type clear_cofactor(const group_value_type &R) {
+                            return bls12_endomorphisms<381>::clear_cofactor_g1(R);
+                        }
                     };
 
                     template<>
@@ -107,6 +117,158 @@ namespace nil {
 #endif
                         constexpr static inline auto h_eff =
                             0xbc69f08f2ee75b3584c6a0ea91b352888e2a8e9145ad7689986ff031508ffe1329c2f178731db956d82bf015d1212b02ec0ec69d7477c1ae954cbc06689f6a359894c0adebbf6b4e8020005aaa95551_cppui636;
+
+                        // [h_eff]R computed with the psi endomorphism rather than the 636-bit h_eff
+                        static inline group_value_type clear_cofactor(const group_value_type &R) {
+                            return bls12_endomorphisms<381>::clear_cofactor_g2(R);
+                        }
+                    };
+
+                    // BN254 G1 is mapped directly by Shallue-van de Woestijne, so A and B are the curve's own.
+                    // The suite is the one used by gnark-crypto.
+                    template<>
+                    struct h2c_suite<typename alt_bn128_254::g1_type<>> {
+                        typedef alt_bn128_254 curve_type;
+                        typedef typename alt_bn128_254::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // BN254G1_XMD:SHA-256_SVDW_RO_
+                        constexpr static std::array<std::uint8_t, 28> suite_id = {
+                            0x42, 0x4e, 0x32, 0x35, 0x34, 0x47, 0x31, 0x5f, 0x58, 0x4d, 0x44,
+                            0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x56,
+                            0x44, 0x57, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        constexpr static inline const field_value_type Ai = field_value_type(0);
+                        constexpr static inline const field_value_type Bi = field_value_type(3);
+                        constexpr static inline const field_value_type Z = field_value_type(1);
+                        constexpr static integral_type h_eff = 1;
+
+                        static inline group_value_type clear_cofactor(const group_value_type &R) {
+                            return R;
+                        }
+                    };
+
+                    // Pallas is reached through the 3-isogenous curve of the Zcash group hash (iso-pallas),
+                    // with SHA-256 in place of BLAKE2b for message expansion
+                    template<>
+                    struct h2c_suite<typename pallas::g1_type<>> {
+                        typedef pallas curve_type;
+                        typedef typename pallas::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // pallas_XMD:SHA-256_SSWU_RO_
+                        constexpr static std::array<std::uint8_t, 27> suite_id = {
+                            0x70, 0x61, 0x6c, 0x6c, 0x61, 0x73, 0x5f, 0x58, 0x4d, 0x44, 0x3a,
+                            0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x53, 0x57,
+                            0x55, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        constexpr static inline const field_value_type Ai = field_value_type(0x18354a2eb0ea8c9c49be2d7258370742b74134581a27a59f92bb4b0b657a014b_cppui255);
+                        constexpr static inline const field_value_type Bi = field_value_type(1265);
+#if BOOST_COMP_GNUC
+                        constexpr static inline field_value_type Z = []() { return -field_value_type(13); }();
+#else
+                        constexpr static inline field_value_type Z = -field_value_type(13);
+#endif
+                        constexpr static integral_type h_eff = 1;
+
+                        static inline group_value_type clear_cofactor(const group_value_type &R) {
+                            return R;
+                        }
+                    };
+
+                    // Vesta is reached through the 3-isogenous curve of the Zcash group hash (iso-vesta),
+                    // with SHA-256 in place of BLAKE2b for message expansion
+                    template<>
+                    struct h2c_suite<typename vesta::g1_type<>> {
+                        typedef vesta curve_type;
+                        typedef typename vesta::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // vesta_XMD:SHA-256_SSWU_RO_
+                        constexpr static std::array<std::uint8_t, 26> suite_id = {
+                            0x76, 0x65, 0x73, 0x74, 0x61, 0x5f, 0x58, 0x4d, 0x44, 0x3a, 0x53,
+                            0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x53, 0x57, 0x55,
+                            0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        constexpr static inline const field_value_type Ai = field_value_type(0x267f9b2ee592271a81639c4d96f787739673928c7d01b212c515ad7242eaa6b1_cppui255);
+                        constexpr static inline const field_value_type Bi = field_value_type(1265);
+#if BOOST_COMP_GNUC
+                        constexpr static inline field_value_type Z = []() { return -field_value_type(13); }();
+#else
+                        constexpr static inline field_value_type Z = -field_value_type(13);
+#endif
+                        constexpr static integral_type h_eff = 1;
+
+                        static inline group_value_type clear_cofactor(const group_value_type &R) {
+                            return R;
+                        }
+                    };
+
+                    // https://datatracker.ietf.org/doc/html/rfc9380#section-8.7
+                    template<>
+                    struct h2c_suite<typename secp256k1::g1_type<>> {
+                        typedef secp256k1 curve_type;
+                        typedef typename secp256k1::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // secp256k1_XMD:SHA-256_SSWU_RO_
+                        constexpr static std::array<std::uint8_t, 30> suite_id = {
+                            0x73, 0x65, 0x63, 0x70, 0x32, 0x35, 0x36, 0x6b, 0x31, 0x5f, 0x58,
+                            0x4d, 0x44, 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f,
+                            0x53, 0x53, 0x57, 0x55, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        constexpr static inline const field_value_type Ai = field_value_type(0x3f8731abdd661adca08a5558f0f5d272e953d363cb6f0e5d405447c01a444533_cppui256);
+                        constexpr static inline const field_value_type Bi = field_value_type(1771);
+#if BOOST_COMP_GNUC
+                        constexpr static inline field_value_type Z = []() { return -field_value_type(11); }();
+#else
+                        constexpr static inline field_value_type Z = -field_value_type(11);
+#endif
+                        constexpr static integral_type h_eff = 1;
+
+                        static inline group_value_type clear_cofactor(const group_value_type &R) {
+                            return R;
+                        }
                     };
                 }    // namespace detail
             }        // namespace curves
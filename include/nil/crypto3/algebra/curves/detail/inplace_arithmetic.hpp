@@ -0,0 +1,86 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_INPLACE_ARITHMETIC_HPP
+#define CRYPTO3_ALGEBRA_CURVES_INPLACE_ARITHMETIC_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief In-place arithmetic for curve elements, whose formulas return a new element.
+                     *    @tparam ElementType Curve element deriving from this struct
+                     *
+                     * Elements with formulas writing into their own coordinates define these members themselves.
+                     */
+                    template<typename ElementType>
+                    struct inplace_arithmetic {
+
+                        /** @brief
+                         *
+                         * Adds any element operator+ of ElementType accepts, such as a cached point.
+                         */
+                        template<typename OtherType>
+                        constexpr ElementType &operator+=(const OtherType &other) {
+                            ElementType &self = static_cast<ElementType &>(*this);
+                            self = self + other;
+                            return self;
+                        }
+
+                        template<typename OtherType>
+                        constexpr ElementType &operator-=(const OtherType &other) {
+                            ElementType &self = static_cast<ElementType &>(*this);
+                            self = self - other;
+                            return self;
+                        }
+
+                        /** @brief
+                         *
+                         * Doubles the element in place, see doubled().
+                         */
+                        constexpr ElementType &double_inplace() {
+                            ElementType &self = static_cast<ElementType &>(*this);
+                            self = self.doubled();
+                            return self;
+                        }
+
+                        /** @brief
+                         *
+                         * Adds an element with Z2 known to be 1 in place, see mixed_add().
+                         */
+                        constexpr ElementType &mixed_add_inplace(const ElementType &other) {
+                            ElementType &self = static_cast<ElementType &>(*this);
+                            self = self.mixed_add(other);
+                            return self;
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_INPLACE_ARITHMETIC_HPP
@@ -26,13 +26,27 @@
 #ifndef CRYPTO3_MARSHALLING_ALGEBRA_CURVES_HPP
 #define CRYPTO3_MARSHALLING_ALGEBRA_CURVES_HPP
 
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/mnt6.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+
+#include <nil/crypto3/algebra/algorithms/batch_inversion.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+#include <nil/crypto3/algebra/type_traits.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <boost/concept/assert.hpp>
 
+#include <algorithm>
+#include <array>
 #include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace nil {
     namespace marshalling {
@@ -163,6 +177,19 @@ namespace nil {
                 return uncompressed_to_g1_point(point_octets, m_byte);
             }
 
+            /** @brief Deserializes a G1 point as octets_to_g1_point does and checks that it lies in the
+             * prime-order subgroup, which the encoding alone does not guarantee.
+             *
+             * @return (false, point) if the point is outside the subgroup
+             */
+            template<typename PointOctetsRange,
+                     typename = typename std::enable_if<
+                         std::is_same<std::uint8_t, typename PointOctetsRange::value_type>::value>::type>
+            static inline std::pair<bool, g1_value_type> octets_to_checked_g1_point(const PointOctetsRange &octets) {
+                const g1_value_type result = octets_to_g1_point(octets);
+                return std::make_pair(result.is_in_subgroup(), result);
+            }
+
             // TODO: use iterators
             template<typename PointOctetsRange,
                      typename = typename std::enable_if<
@@ -183,6 +210,51 @@ namespace nil {
                 return uncompressed_to_g2_point(point_octets, m_byte);
             }
 
+            /** @brief Deserializes a G2 point and checks that it lies in the prime-order subgroup, see
+             * octets_to_checked_g1_point
+             *
+             * @return (false, point) if the point is outside the subgroup
+             */
+            template<typename PointOctetsRange,
+                     typename = typename std::enable_if<
+                         std::is_same<std::uint8_t, typename PointOctetsRange::value_type>::value>::type>
+            static inline std::pair<bool, g2_value_type> octets_to_checked_g2_point(const PointOctetsRange &octets) {
+                const g2_value_type result = octets_to_g2_point(octets);
+                return std::make_pair(result.is_in_subgroup(), result);
+            }
+
+            /** @brief Decompresses count consecutive compressed G1 points stored in octets, writing them to
+             * out, which may point to Jacobian or affine elements. The work is split between threads_number
+             * threads. Every point is validated; invalid points are written as the point at infinity.
+             *
+             * @return true if all points were valid
+             */
+            template<typename G1ValueType>
+            static inline bool octets_to_g1_points(const std::uint8_t *octets,
+                                                   std::size_t count,
+                                                   G1ValueType *out,
+                                                   bool check_subgroup = false,
+                                                   std::size_t threads_number = std::thread::hardware_concurrency()) {
+                return parallel_decompress(count, threads_number, [&](std::size_t i) {
+                    return decompress_g1(octets + i * sizeof_field_element, out[i], check_subgroup);
+                });
+            }
+
+            /** @brief Decompresses count consecutive compressed G2 points, see octets_to_g1_points
+             *
+             * @return true if all points were valid
+             */
+            template<typename G2ValueType>
+            static inline bool octets_to_g2_points(const std::uint8_t *octets,
+                                                   std::size_t count,
+                                                   G2ValueType *out,
+                                                   bool check_subgroup = false,
+                                                   std::size_t threads_number = std::thread::hardware_concurrency()) {
+                return parallel_decompress(count, threads_number, [&](std::size_t i) {
+                    return decompress_g2(octets + i * 2 * sizeof_field_element, out[i], check_subgroup);
+                });
+            }
+
         protected:
             constexpr static const std::uint8_t C_bit = 0x80;
             constexpr static const std::uint8_t I_bit = 0x40;
@@ -303,6 +375,149 @@ namespace nil {
                 return result;
             }
 
+            template<typename DecompressFunction>
+            static inline bool parallel_decompress(std::size_t count,
+                                                   std::size_t threads_number,
+                                                   DecompressFunction decompress) {
+                threads_number = std::max<std::size_t>(1, std::min(threads_number, count));
+
+                // std::vector<bool> packs bits, so concurrent writes to it would race
+                std::vector<std::uint8_t> valid(threads_number, 1);
+                auto worker = [&](std::size_t t) {
+                    for (std::size_t i = count * t / threads_number; i < count * (t + 1) / threads_number; ++i) {
+                        if (!decompress(i)) {
+                            valid[t] = 0;
+                        }
+                    }
+                };
+
+                std::vector<std::thread> workers;
+                for (std::size_t t = 1; t < threads_number; ++t) {
+                    workers.emplace_back(worker, t);
+                }
+                worker(0);
+                for (auto &w : workers) {
+                    w.join();
+                }
+
+                return std::find(valid.begin(), valid.end(), 0) == valid.end();
+            }
+
+            /// Reads a big-endian field element with the flag bits of the first octet masked off
+            static inline bool read_fp(const std::uint8_t *octets, bool first, g1_field_value_type &result) {
+                std::array<std::uint8_t, sizeof_field_element> buf;
+                std::copy(octets, octets + sizeof_field_element, buf.begin());
+                if (first) {
+                    buf[0] &= 0x1F;
+                }
+                integral_type x;
+                multiprecision::import_bits(x, buf.rbegin(), buf.rend(), 8, false);
+                result = g1_field_value_type(x);
+                return x < g1_field_value_type::modulus;
+            }
+
+            template<typename GroupValueType, typename FieldValueType>
+            static inline typename std::enable_if<
+                std::is_same<typename GroupValueType::coordinates, algebra::curves::coordinates::affine>::value,
+                GroupValueType>::type
+                make_point(const FieldValueType &x, const FieldValueType &y) {
+                return GroupValueType(x, y);
+            }
+
+            template<typename GroupValueType, typename FieldValueType>
+            static inline typename std::enable_if<
+                !std::is_same<typename GroupValueType::coordinates, algebra::curves::coordinates::affine>::value,
+                GroupValueType>::type
+                make_point(const FieldValueType &x, const FieldValueType &y) {
+                return GroupValueType(x, y, FieldValueType::one());
+            }
+
+            /// Checks the flags of a compressed encoding and whether it is the point at infinity
+            static inline bool read_flags(const std::uint8_t *octets, std::size_t size, std::uint8_t &m_byte,
+                                          bool &infinity) {
+                m_byte = octets[0] & 0xE0;
+                if (!(m_byte & C_bit) || m_byte == 0xE0) {
+                    return false;
+                }
+                infinity = m_byte & I_bit;
+                if (infinity) {
+                    return !(octets[0] & 0x3F) && std::all_of(octets + 1, octets + size, [](std::uint8_t c) {
+                        return c == 0;
+                    });
+                }
+                return true;
+            }
+
+            template<typename G1ValueType>
+            static inline bool decompress_g1(const std::uint8_t *octets, G1ValueType &out, bool check_subgroup) {
+                out = G1ValueType::zero();
+
+                std::uint8_t m_byte;
+                bool infinity;
+                if (!read_flags(octets, sizeof_field_element, m_byte, infinity)) {
+                    return false;
+                }
+                if (infinity) {
+                    return true;
+                }
+
+                g1_field_value_type x;
+                if (!read_fp(octets, true, x)) {
+                    return false;
+                }
+                // the p = 3 (mod 4) square root is verified by squaring, which also rejects x off the curve
+                // without a separate Legendre symbol
+                g1_field_value_type y2 = x.squared() * x + g1_value_type::params_type::b;
+                g1_field_value_type y = y2.sqrt();
+                if (y.squared() != y2) {
+                    return false;
+                }
+                if (sign_gf_p(y) != bool(m_byte & S_bit)) {
+                    y = -y;
+                }
+
+                if (check_subgroup && !g1_value_type(x, y, g1_field_value_type::one()).is_in_subgroup()) {
+                    return false;
+                }
+                out = make_point<G1ValueType>(x, y);
+                return true;
+            }
+
+            template<typename G2ValueType>
+            static inline bool decompress_g2(const std::uint8_t *octets, G2ValueType &out, bool check_subgroup) {
+                out = G2ValueType::zero();
+
+                std::uint8_t m_byte;
+                bool infinity;
+                if (!read_flags(octets, 2 * sizeof_field_element, m_byte, infinity)) {
+                    return false;
+                }
+                if (infinity) {
+                    return true;
+                }
+
+                g1_field_value_type x_0, x_1;
+                if (!read_fp(octets, true, x_1) || !read_fp(octets + sizeof_field_element, false, x_0)) {
+                    return false;
+                }
+                g2_field_value_type x(x_0, x_1);
+                g2_field_value_type y2 = x.squared() * x + g2_value_type::params_type::b;
+                // Tonelli-Shanks in Fp2 does not terminate on a non-square
+                if (!y2.is_square()) {
+                    return false;
+                }
+                g2_field_value_type y = y2.sqrt();
+                if (sign_gf_p(y) != bool(m_byte & S_bit)) {
+                    y = -y;
+                }
+
+                if (check_subgroup && !g2_value_type(x, y, g2_field_value_type::one()).is_in_subgroup()) {
+                    return false;
+                }
+                out = make_point<G2ValueType>(x, y);
+                return true;
+            }
+
             static inline bool sign_gf_p(const g1_field_value_type &v) {
                 static const typename g1_field_value_type::integral_type half_p =
                     (g1_field_value_type::modulus - integral_type(1)) / integral_type(2);
@@ -337,6 +552,480 @@ namespace nil {
                 return result;
             }
         };
+        namespace detail {
+            template<typename FieldType, bool = algebra::is_extended_field<FieldType>::value>
+            struct serializer_base_field {
+                typedef FieldType type;
+            };
+
+            template<typename FieldType>
+            struct serializer_base_field<FieldType, true> {
+                typedef typename serializer_base_field<typename FieldType::underlying_field_type>::type type;
+            };
+
+            template<typename Coordinates>
+            struct is_jacobian_coordinates {
+                constexpr static const bool value =
+                    std::is_same<Coordinates, algebra::curves::coordinates::jacobian>::value ||
+                    std::is_same<Coordinates, algebra::curves::coordinates::jacobian_with_a4_0>::value ||
+                    std::is_same<Coordinates, algebra::curves::coordinates::jacobian_with_a4_minus_3>::value;
+            };
+
+            /*
+             * Point encoding shared by the short Weierstrass groups of the pairing and cycle curves. Coordinates
+             * are written big-endian, extension field elements from the highest coefficient down, and the flags
+             * occupy the spare top bits of the first octet:
+             *  - three or more spare bits: C (compressed), I (infinity) and S (sign of y) as for BLS12-381;
+             *  - two spare bits: I and S, compression is implied by the encoding length;
+             *  - one spare bit: S, the point at infinity is the all-zero encoding. This is only used for curves
+             *    where b is not a square, so that no point has x = 0.
+             * S is set when the highest nonzero coefficient of y is greater than (p - 1) / 2.
+             */
+            template<typename GroupType>
+            struct short_weierstrass_group_serializer {
+                typedef GroupType group_type;
+                typedef typename group_type::value_type value_type;
+                typedef typename value_type::params_type params_type;
+                typedef typename group_type::field_type field_type;
+                typedef typename field_type::value_type field_value_type;
+                typedef typename serializer_base_field<field_type>::type base_field_type;
+                typedef typename base_field_type::value_type base_value_type;
+                typedef typename base_field_type::integral_type integral_type;
+
+                constexpr static const std::size_t sizeof_base_element = (base_field_type::modulus_bits + 7) / 8;
+                constexpr static const std::size_t sizeof_field_element = field_type::arity * sizeof_base_element;
+                constexpr static const std::size_t spare_bits = 8 * sizeof_base_element - base_field_type::modulus_bits;
+                static_assert(spare_bits > 0, "no room for the flag bits");
+
+                constexpr static const std::uint8_t C_bit = spare_bits >= 3 ? 0x80 : 0;
+                constexpr static const std::uint8_t I_bit = spare_bits >= 3 ? 0x40 : (spare_bits == 2 ? 0x80 : 0);
+                constexpr static const std::uint8_t S_bit =
+                    spare_bits >= 3 ? 0x20 : (spare_bits == 2 ? 0x40 : 0x80);
+                constexpr static const std::uint8_t flags_mask = C_bit | I_bit | S_bit;
+
+                typedef std::array<std::uint8_t, sizeof_field_element> compressed_octets;
+                typedef std::array<std::uint8_t, 2 * sizeof_field_element> uncompressed_octets;
+
+                static inline compressed_octets point_to_octets_compress(const value_type &point) {
+                    compressed_octets result = {0};
+                    if (point.is_zero()) {
+                        result[0] = C_bit | I_bit;
+                        return result;
+                    }
+                    field_value_type x, y;
+                    to_affine(point, point_z(point).inversed(), x, y);
+                    write_point(x, y, true, result.data());
+                    return result;
+                }
+
+                static inline uncompressed_octets point_to_octets(const value_type &point) {
+                    uncompressed_octets result = {0};
+                    if (point.is_zero()) {
+                        result[0] = I_bit;
+                        return result;
+                    }
+                    field_value_type x, y;
+                    to_affine(point, point_z(point).inversed(), x, y);
+                    write_point(x, y, false, result.data());
+                    return result;
+                }
+
+                /// Decodes a compressed or uncompressed encoding, telling them apart by the length
+                template<typename PointOctetsRange>
+                static inline std::pair<bool, value_type> octets_to_point(const PointOctetsRange &octets) {
+                    BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<PointOctetsRange>));
+
+                    std::array<std::uint8_t, 2 * sizeof_field_element> buf;
+                    const std::size_t size = std::distance(octets.begin(), octets.end());
+                    if (size != sizeof_field_element && size != buf.size()) {
+                        return std::make_pair(false, value_type::zero());
+                    }
+                    std::copy(octets.begin(), octets.end(), buf.begin());
+
+                    value_type result;
+                    bool valid = read_point(buf.data(), size == sizeof_field_element, result);
+                    return std::make_pair(valid, result);
+                }
+
+                /// Decodes as octets_to_point does and also checks that the point lies in the prime-order subgroup
+                template<typename PointOctetsRange>
+                static inline std::pair<bool, value_type> octets_to_checked_point(const PointOctetsRange &octets) {
+                    std::pair<bool, value_type> result = octets_to_point(octets);
+                    result.first = result.first &&
+                                   algebra::curves::detail::subgroup_check_policy<params_type>::process(result.second);
+                    return result;
+                }
+
+                /// Encodes [first, last) with one field inversion for all the points, returns the end of output
+                template<typename InputIterator>
+                static inline std::uint8_t *points_to_octets(InputIterator first, InputIterator last,
+                                                             std::uint8_t *out, bool compress) {
+                    const std::size_t size = compress ? sizeof_field_element : 2 * sizeof_field_element;
+
+                    std::vector<value_type> points(first, last);
+                    std::vector<field_value_type> z_inversed;
+                    z_inversed.reserve(points.size());
+                    for (const value_type &point : points) {
+                        z_inversed.push_back(point_z(point));
+                    }
+                    algebra::batch_inversion(z_inversed.begin(), z_inversed.end(), z_inversed.begin());
+
+                    for (std::size_t i = 0; i < points.size(); ++i, out += size) {
+                        std::fill(out, out + size, 0);
+                        if (points[i].is_zero()) {
+                            out[0] = (compress ? C_bit : 0) | I_bit;
+                            continue;
+                        }
+                        field_value_type x, y;
+                        to_affine(points[i], z_inversed[i], x, y);
+                        write_point(x, y, compress, out);
+                    }
+                    return out;
+                }
+
+                /**
+                 * @brief Decodes count consecutive encodings of the same kind into out. Invalid points are
+                 * written as the point at infinity.
+                 *
+                 * @return true if all points were valid
+                 */
+                template<typename OutputIterator>
+                static inline bool octets_to_points(const std::uint8_t *octets, std::size_t count, OutputIterator out,
+                                                    bool compressed) {
+                    const std::size_t size = compressed ? sizeof_field_element : 2 * sizeof_field_element;
+
+                    bool valid = true;
+                    for (std::size_t i = 0; i < count; ++i, octets += size) {
+                        value_type point;
+                        valid = read_point(octets, compressed, point) && valid;
+                        *out++ = point;
+                    }
+                    return valid;
+                }
+
+            protected:
+                static inline field_value_type point_z(const value_type &point) {
+                    return point_z_impl(point, std::is_same<typename value_type::coordinates,
+                                                            algebra::curves::coordinates::affine>());
+                }
+
+                template<typename ValueType>
+                static inline field_value_type point_z_impl(const ValueType &, std::true_type) {
+                    return field_value_type::one();
+                }
+
+                template<typename ValueType>
+                static inline field_value_type point_z_impl(const ValueType &point, std::false_type) {
+                    return point.Z;
+                }
+
+                static inline void to_affine(const value_type &point, const field_value_type &z_inversed,
+                                             field_value_type &x, field_value_type &y) {
+                    if (is_jacobian_coordinates<typename value_type::coordinates>::value) {
+                        const field_value_type z2 = z_inversed.squared();
+                        x = point.X * z2;
+                        y = point.Y * z2 * z_inversed;
+                    } else {
+                        x = point.X * z_inversed;
+                        y = point.Y * z_inversed;
+                    }
+                }
+
+                template<typename GroupValueType = value_type>
+                static inline typename std::enable_if<
+                    std::is_same<typename GroupValueType::coordinates, algebra::curves::coordinates::affine>::value,
+                    GroupValueType>::type
+                    make_point(const field_value_type &x, const field_value_type &y) {
+                    return GroupValueType(x, y);
+                }
+
+                template<typename GroupValueType = value_type>
+                static inline typename std::enable_if<
+                    !std::is_same<typename GroupValueType::coordinates, algebra::curves::coordinates::affine>::value,
+                    GroupValueType>::type
+                    make_point(const field_value_type &x, const field_value_type &y) {
+                    return GroupValueType(x, y, field_value_type::one());
+                }
+
+                /// Curve coefficients are given either as field elements or as integers of the base curve
+                static inline const field_value_type &coefficient(const field_value_type &c) {
+                    return c;
+                }
+
+                template<typename FieldType = field_type>
+                static inline typename std::enable_if<!algebra::is_extended_field<FieldType>::value,
+                                                      field_value_type>::type
+                    coefficient(const integral_type &c) {
+                    return field_value_type(c);
+                }
+
+                template<typename FieldType = field_type>
+                static inline typename std::enable_if<algebra::is_extended_field<FieldType>::value,
+                                                      field_value_type>::type
+                    coefficient(const integral_type &c) {
+                    // an integer coefficient of a twist is inherited from the base curve; it is only zero there
+                    BOOST_ASSERT(c == integral_type(0));
+                    return field_value_type::zero();
+                }
+
+                static inline field_value_type curve_rhs(const field_value_type &x) {
+                    return (x.squared() + coefficient(params_type::a)) * x + coefficient(params_type::b);
+                }
+
+                static inline void write_base(const base_value_type &v, std::uint8_t *out) {
+                    multiprecision::export_bits(v.data.template convert_to<integral_type>(),
+                                                std::reverse_iterator<std::uint8_t *>(out + sizeof_base_element),
+                                                8, false);
+                }
+
+                static inline bool read_base(const std::uint8_t *in, base_value_type &v) {
+                    integral_type x;
+                    multiprecision::import_bits(x,
+                                                std::reverse_iterator<const std::uint8_t *>(in + sizeof_base_element),
+                                                std::reverse_iterator<const std::uint8_t *>(in),
+                                                8,
+                                                false);
+                    v = base_value_type(x);
+                    return x < base_value_type::modulus;
+                }
+
+                template<typename FieldType = field_type>
+                static inline typename std::enable_if<!algebra::is_extended_field<FieldType>::value>::type
+                    write_field(const field_value_type &v, std::uint8_t *out) {
+                    write_base(v, out);
+                }
+
+                template<typename FieldType = field_type>
+                static inline typename std::enable_if<algebra::is_extended_field<FieldType>::value>::type
+                    write_field(const field_value_type &v, std::uint8_t *out) {
+                    for (std::size_t i = field_type::arity; i-- > 0; out += sizeof_base_element) {
+                        write_base(v.data[i], out);
+                    }
+                }
+
+                template<typename FieldType = field_type>
+                static inline typename std::enable_if<!algebra::is_extended_field<FieldType>::value, bool>::type
+                    read_field(const std::uint8_t *in, field_value_type &v) {
+                    return read_base(in, v);
+                }
+
+                template<typename FieldType = field_type>
+                static inline typename std::enable_if<algebra::is_extended_field<FieldType>::value, bool>::type
+                    read_field(const std::uint8_t *in, field_value_type &v) {
+                    bool valid = true;
+                    for (std::size_t i = field_type::arity; i-- > 0; in += sizeof_base_element) {
+                        valid = read_base(in, v.data[i]) && valid;
+                    }
+                    return valid;
+                }
+
+                static inline bool sign(const base_value_type &v) {
+                    static const integral_type half_p =
+                        (base_value_type::modulus - integral_type(1)) / integral_type(2);
+                    return v.data.template convert_to<integral_type>() > half_p;
+                }
+
+                template<typename FieldType = field_type>
+                static inline typename std::enable_if<algebra::is_extended_field<FieldType>::value, bool>::type
+                    sign(const field_value_type &v) {
+                    for (std::size_t i = field_type::arity; i-- > 1;) {
+                        if (!v.data[i].is_zero()) {
+                            return sign(v.data[i]);
+                        }
+                    }
+                    return sign(v.data[0]);
+                }
+
+                static inline void write_point(const field_value_type &x, const field_value_type &y, bool compress,
+                                               std::uint8_t *out) {
+                    write_field(x, out);
+                    if (compress) {
+                        out[0] |= C_bit;
+                        if (sign(y)) {
+                            out[0] |= S_bit;
+                        }
+                    } else {
+                        write_field(y, out + sizeof_field_element);
+                    }
+                }
+
+                static inline bool read_point(const std::uint8_t *in, bool compressed, value_type &result) {
+                    const std::size_t size = compressed ? sizeof_field_element : 2 * sizeof_field_element;
+                    result = value_type::zero();
+
+                    const std::uint8_t m_byte = in[0] & flags_mask;
+                    if (bool(m_byte & C_bit) != (compressed && C_bit) || (!compressed && (m_byte & S_bit))) {
+                        return false;
+                    }
+
+                    std::array<std::uint8_t, 2 * sizeof_field_element> buf;
+                    std::copy(in, in + size, buf.begin());
+                    buf[0] &= ~flags_mask;
+                    const bool rest_zero = std::all_of(buf.begin(), buf.begin() + size, [](std::uint8_t c) {
+                        return c == 0;
+                    });
+
+                    if (I_bit ? bool(m_byte & I_bit) : (rest_zero && !m_byte)) {
+                        return rest_zero && !(m_byte & S_bit);
+                    }
+
+                    field_value_type x, y;
+                    if (!read_field(buf.data(), x)) {
+                        return false;
+                    }
+                    const field_value_type y2 = curve_rhs(x);
+                    if (compressed) {
+                        if (!y2.is_square()) {
+                            return false;
+                        }
+                        y = y2.sqrt();
+                        if (sign(y) != bool(m_byte & S_bit)) {
+                            y = -y;
+                        }
+                    } else {
+                        if (!read_field(buf.data() + sizeof_field_element, y) || y.squared() != y2) {
+                            return false;
+                        }
+                    }
+
+                    result = make_point(x, y);
+                    return true;
+                }
+            };
+
+            /// Serializer of a pairing-friendly curve, exposing the interface of the BLS12-381 one for G1 and G2
+            template<typename CurveType>
+            struct pairing_curve_element_serializer {
+                typedef CurveType curve_type;
+
+                typedef short_weierstrass_group_serializer<typename curve_type::template g1_type<>> g1_serializer;
+                typedef short_weierstrass_group_serializer<typename curve_type::template g2_type<>> g2_serializer;
+
+                typedef typename g1_serializer::value_type g1_value_type;
+                typedef typename g2_serializer::value_type g2_value_type;
+
+                typedef typename g1_serializer::compressed_octets compressed_g1_octets;
+                typedef typename g1_serializer::uncompressed_octets uncompressed_g1_octets;
+                typedef typename g2_serializer::compressed_octets compressed_g2_octets;
+                typedef typename g2_serializer::uncompressed_octets uncompressed_g2_octets;
+
+                static inline compressed_g1_octets point_to_octets_compress(const g1_value_type &point) {
+                    return g1_serializer::point_to_octets_compress(point);
+                }
+
+                static inline uncompressed_g1_octets point_to_octets(const g1_value_type &point) {
+                    return g1_serializer::point_to_octets(point);
+                }
+
+                static inline compressed_g2_octets point_to_octets_compress(const g2_value_type &point) {
+                    return g2_serializer::point_to_octets_compress(point);
+                }
+
+                static inline uncompressed_g2_octets point_to_octets(const g2_value_type &point) {
+                    return g2_serializer::point_to_octets(point);
+                }
+
+                /// Decodes a point known to be valid; untrusted input goes through octets_to_checked_g1_point
+                template<typename PointOctetsRange>
+                static inline g1_value_type octets_to_g1_point(const PointOctetsRange &octets) {
+                    std::pair<bool, g1_value_type> result = g1_serializer::octets_to_point(octets);
+                    BOOST_ASSERT(result.first);
+                    return result.second;
+                }
+
+                /** @brief Deserializes a G1 point, checking the encoding, that the point is on the curve and that
+                 * it lies in the prime-order subgroup
+                 *
+                 * @return (false, point) if any of the checks fails
+                 */
+                template<typename PointOctetsRange>
+                static inline std::pair<bool, g1_value_type>
+                    octets_to_checked_g1_point(const PointOctetsRange &octets) {
+                    return g1_serializer::octets_to_checked_point(octets);
+                }
+
+                /// Decodes a point known to be valid; untrusted input goes through octets_to_checked_g2_point
+                template<typename PointOctetsRange>
+                static inline g2_value_type octets_to_g2_point(const PointOctetsRange &octets) {
+                    std::pair<bool, g2_value_type> result = g2_serializer::octets_to_point(octets);
+                    BOOST_ASSERT(result.first);
+                    return result.second;
+                }
+
+                /** @brief Deserializes a G2 point with the checks of octets_to_checked_g1_point
+                 *
+                 * @return (false, point) if any of the checks fails
+                 */
+                template<typename PointOctetsRange>
+                static inline std::pair<bool, g2_value_type>
+                    octets_to_checked_g2_point(const PointOctetsRange &octets) {
+                    return g2_serializer::octets_to_checked_point(octets);
+                }
+            };
+
+            /// Serializer of a curve of a cycle, which has a single prime-order group
+            template<typename CurveType>
+            struct cycle_curve_element_serializer {
+                typedef CurveType curve_type;
+
+                typedef short_weierstrass_group_serializer<typename curve_type::template g1_type<>> g1_serializer;
+                typedef typename g1_serializer::value_type g1_value_type;
+
+                typedef typename g1_serializer::compressed_octets compressed_g1_octets;
+                typedef typename g1_serializer::uncompressed_octets uncompressed_g1_octets;
+
+                static inline compressed_g1_octets point_to_octets_compress(const g1_value_type &point) {
+                    return g1_serializer::point_to_octets_compress(point);
+                }
+
+                static inline uncompressed_g1_octets point_to_octets(const g1_value_type &point) {
+                    return g1_serializer::point_to_octets(point);
+                }
+
+                /// Decodes a point known to be valid; untrusted input goes through octets_to_checked_g1_point
+                template<typename PointOctetsRange>
+                static inline g1_value_type octets_to_g1_point(const PointOctetsRange &octets) {
+                    std::pair<bool, g1_value_type> result = g1_serializer::octets_to_point(octets);
+                    BOOST_ASSERT(result.first);
+                    return result.second;
+                }
+
+                /** @brief Deserializes a point, checking the encoding and that the point is on the curve. The
+                 * group has prime order, so this also places the point in it.
+                 *
+                 * @return (false, point) if any of the checks fails
+                 */
+                template<typename PointOctetsRange>
+                static inline std::pair<bool, g1_value_type>
+                    octets_to_checked_g1_point(const PointOctetsRange &octets) {
+                    return g1_serializer::octets_to_point(octets);
+                }
+            };
+        }    // namespace detail
+
+        template<>
+        struct curve_element_serializer<algebra::curves::bls12_377>
+            : public detail::pairing_curve_element_serializer<algebra::curves::bls12_377> { };
+
+        template<>
+        struct curve_element_serializer<algebra::curves::alt_bn128_254>
+            : public detail::pairing_curve_element_serializer<algebra::curves::alt_bn128_254> { };
+
+        template<>
+        struct curve_element_serializer<algebra::curves::mnt4_298>
+            : public detail::pairing_curve_element_serializer<algebra::curves::mnt4_298> { };
+
+        template<>
+        struct curve_element_serializer<algebra::curves::mnt6_298>
+            : public detail::pairing_curve_element_serializer<algebra::curves::mnt6_298> { };
+
+        template<>
+        struct curve_element_serializer<algebra::curves::pallas>
+            : public detail::cycle_curve_element_serializer<algebra::curves::pallas> { };
+
+        template<>
+        struct curve_element_serializer<algebra::curves::vesta>
+            : public detail::cycle_curve_element_serializer<algebra::curves::vesta> { };
     }    // namespace marshalling
 }    // namespace nil
 
@@ -30,6 +30,7 @@
 #include <nil/crypto3/algebra/curves/detail/pallas/params.hpp>
 // #include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/element_g1.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian_with_a4_0/element_g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective_with_a4_0/element_g1.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -53,12 +53,12 @@ namespace nil {
                         bool found_one = false;
                         for (auto i = static_cast<std::int64_t>(multiprecision::msb(scalar)); i >= 0; --i) {
                             if (found_one) {
-                                result = result.doubled();
+                                result.double_inplace();
                             }
 
                             if (multiprecision::bit_test(scalar, i)) {
                                 found_one = true;
-                                result = result + base;
+                                result += base;
                             }
                         }
 
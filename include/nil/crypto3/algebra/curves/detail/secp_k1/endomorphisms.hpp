@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SECP_K1_ENDOMORPHISMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SECP_K1_ENDOMORPHISMS_HPP
+
+#include <array>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/secp_k1/types.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/detail/literals.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief The endomorphism phi(x, y) = (beta * x, y) of secp256k1, which multiplies the points
+                     * of G1 by lambda, and the short lattice basis (a1, b1), (a2, b2) of the kernel of
+                     * (i, j) -> i + j * lambda mod r used to split scalars for it. Points are expected in Jacobian
+                     * or homogeneous projective coordinates.
+                     *    @tparam Version version of the curve
+                     *
+                     */
+                    template<std::size_t Version>
+                    struct secp_k1_endomorphism_params;
+
+                    template<>
+                    struct secp_k1_endomorphism_params<256> {
+                        using integral_type = typename secp_k1_types<256>::integral_type;
+
+                        ///< primitive cube root of unity in the base field
+                        constexpr static const integral_type beta =
+                            0x7ae96a2b657c07106e64479eac3434e99cf0497512f58995c1396c28719501ee_cppui256;
+                        ///< phi(P) = [lambda]P
+                        constexpr static const integral_type lambda =
+                            0x5363ad4cc05c30e0a5261c028812645a122e22ea20816678df02967c1b23bd72_cppui256;
+
+                        ///< a1 = b2
+                        constexpr static const integral_type a1 = 0x3086d221a7d46bcde86c90e49284eb15_cppui256;
+                        ///< b1 = -minus_b1
+                        constexpr static const integral_type minus_b1 = 0xe4437ed6010e88286f547fa90abfe4c3_cppui256;
+                        constexpr static const integral_type a2 = 0x114ca50f7a8e2f3f657c1108d9d44cfd8_cppui256;
+                    };
+
+                    template<std::size_t Version>
+                    struct secp_k1_endomorphisms : public secp_k1_endomorphism_params<Version> {
+                        using params_type = secp_k1_endomorphism_params<Version>;
+
+                        using g1_field_value_type = typename secp_k1_types<Version>::g1_field_type::value_type;
+                        using scalar_field_type = typename secp_k1_types<Version>::scalar_field_type;
+
+                        /** @brief phi(x, y) = (beta * x, y) on G1 */
+                        template<typename G1ValueType>
+                        static G1ValueType phi(const G1ValueType &P) {
+                            static const g1_field_value_type b = g1_field_value_type(params_type::beta);
+                            return G1ValueType(P.X * b, P.Y, P.Z);
+                        }
+
+                        /** @brief (k1, k2) with k = k1 + k2 * lambda mod r and |k1|, |k2| < 2^128 for 0 <= k < r:
+                         * k is written in the rational basis of the lattice and rounded to the nearest lattice
+                         * point, c1 = round(b2 * k / r), c2 = round(-b1 * k / r), which leaves
+                         * k1 = k - c1 * a1 - c2 * a2, k2 = -c1 * b1 - c2 * b2.
+                         */
+                        static std::array<multiprecision::cpp_int, 2> decompose(const multiprecision::cpp_int &k) {
+                            static const multiprecision::cpp_int r(scalar_field_type::modulus);
+                            static const multiprecision::cpp_int a1(params_type::a1);
+                            static const multiprecision::cpp_int minus_b1(params_type::minus_b1);
+                            static const multiprecision::cpp_int a2(params_type::a2);
+
+                            const multiprecision::cpp_int c1 = (a1 * k + r / 2) / r;
+                            const multiprecision::cpp_int c2 = (minus_b1 * k + r / 2) / r;
+
+                            return {{k - c1 * a1 - c2 * a2, c1 * minus_b1 - c2 * a1}};
+                        }
+                    };
+
+                    template<>
+                    struct glv_endomorphism_policy<secp_k1_g1_params<256, forms::short_weierstrass>>
+                        : public secp_k1_endomorphisms<256> {
+                        constexpr static const bool value = true;
+                    };
+
+                    constexpr typename secp_k1_endomorphism_params<256>::integral_type const
+                        secp_k1_endomorphism_params<256>::beta;
+                    constexpr typename secp_k1_endomorphism_params<256>::integral_type const
+                        secp_k1_endomorphism_params<256>::lambda;
+                    constexpr typename secp_k1_endomorphism_params<256>::integral_type const
+                        secp_k1_endomorphism_params<256>::a1;
+                    constexpr typename secp_k1_endomorphism_params<256>::integral_type const
+                        secp_k1_endomorphism_params<256>::minus_b1;
+                    constexpr typename secp_k1_endomorphism_params<256>::integral_type const
+                        secp_k1_endomorphism_params<256>::a2;
+
+                    constexpr bool const
+                        glv_endomorphism_policy<secp_k1_g1_params<256, forms::short_weierstrass>>::value;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SECP_K1_ENDOMORPHISMS_HPP
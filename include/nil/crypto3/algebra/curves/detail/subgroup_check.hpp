@@ -41,6 +41,33 @@ namespace nil {
                     bool subgroup_check(const GroupValueType &p) {
                         return (p * GroupValueType::group_type::curve_type::q).is_zero();
                     }
+
+                    /** @brief Prime-order subgroup membership test for points of a group with parameters
+                     * CurveParams. The generic policy multiplies by the subgroup order; curves with an efficient
+                     * endomorphism specialize it with a test costing a fraction of that.
+                     *    @tparam CurveParams Parameters of the group
+                     *
+                     */
+                    template<typename CurveParams>
+                    struct subgroup_check_policy {
+                        template<typename GroupValueType>
+                        static bool process(const GroupValueType &P) {
+                            return (P * GroupValueType::group_type::curve_type::scalar_field_type::modulus).is_zero();
+                        }
+                    };
+
+                    /** @brief Checks that every point of [first, last) lies in the prime-order subgroup,
+                     * stopping at the first point which does not.
+                     */
+                    template<typename InputIterator>
+                    bool is_in_subgroup_batch(InputIterator first, InputIterator last) {
+                        for (; first != last; ++first) {
+                            if (!first->is_in_subgroup()) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
@@ -56,7 +56,8 @@ namespace nil {
                     /* @brief Curve Jacobi quartics form.
                      * Description: http://www.hyperelliptic.org/EFD/g1p/auto-jquartic.html
                      */
-                    struct jacobi_quatrics { };
+                    struct jacobi_quartics { };
+                    using jacobi_quatrics = jacobi_quartics;
                     /* @brief Curve Montgomery form.
                      * Description: http://www.hyperelliptic.org/EFD/g1p/auto-montgom.html
                      */
@@ -26,6 +26,8 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_PARAMS_HPP
 #define CRYPTO3_ALGEBRA_CURVES_PARAMS_HPP
 
+#include <cstddef>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
@@ -37,6 +39,24 @@ namespace nil {
                 template<typename GroupType>
                 struct wnaf_params;
 
+                /**
+                 * Shape of the generator table used by fixed-base scalar multiplication: scalars of up to
+                 * scalar_bits bits are split into signed digits of window bits. Specialized per group in
+                 * curves/params/fixed_base.
+                 */
+                template<typename GroupType>
+                struct fixed_base_params {
+
+                    constexpr static const std::size_t scalar_bits =
+                        GroupType::curve_type::scalar_field_type::modulus_bits;
+                    constexpr static const std::size_t window = 4;
+                };
+
+                template<typename GroupType>
+                constexpr std::size_t const fixed_base_params<GroupType>::scalar_bits;
+                template<typename GroupType>
+                constexpr std::size_t const fixed_base_params<GroupType>::window;
+
             }    // namespace curves
         }        // namespace algebra
     }            // namespace crypto3
@@ -28,6 +28,7 @@
 
 #include <nil/crypto3/algebra/curves/detail/secp_k1/types.hpp>
 #include <nil/crypto3/algebra/curves/detail/secp_k1/g1.hpp>
+#include <nil/crypto3/algebra/curves/detail/secp_k1/endomorphisms.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -27,6 +27,7 @@
 #define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_HPP
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
+#include <nil/crypto3/algebra/fields/detail/legendre.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
 
 #include <nil/crypto3/multiprecision/ressol.hpp>
@@ -59,6 +60,11 @@ namespace nil {
                         constexpr static const modular_params_type modulus_params = policy_type::modulus_params;
                         constexpr static const integral_type modulus = policy_type::modulus;
 
+                        typedef fixed_exponent_chain<policy_type::modulus_bits, 5> exponent_chain_type;
+                        // (p + 1) / 4, only meaningful for p = 3 (mod 4)
+                        constexpr static const exponent_chain_type sqrt_exponent_chain =
+                            exponent_chain_type((modulus >> 2) + 1);
+
                         using data_type = modular_type;
                         data_type data;
 
@@ -196,6 +202,13 @@ namespace nil {
 
                         // TODO: maybe incorrect result here
                         constexpr element_fp sqrt() const {
+                            if (modulus % 4 == 3) {
+                                element_fp root = power(*this, sqrt_exponent_chain);
+                                if (root.squared() == *this) {
+                                    return root;
+                                }
+                            }
+
                             return element_fp(ressol(data));
                         }
 
@@ -211,21 +224,20 @@ namespace nil {
                             return element_fp(data * data);    // maybe can be done more effective
                         }
 
-                        // TODO: maybe error here
                         constexpr bool is_square() const {
-                            return (this->sqrt() != -1);    // maybe can be done more effective
+                            return jacobi_symbol(data.template convert_to<integral_type>(), modulus) >= 0;
                         }
 
                         template<typename PowerType,
                                  typename = typename std::enable_if<boost::is_integral<PowerType>::value>::type>
                         constexpr element_fp pow(const PowerType pwr) const {
-                            return element_fp(multiprecision::powm(data, multiprecision::uint128_t(pwr)));
+                            return power(*this, multiprecision::uint128_t(pwr));
                         }
 
                         template<typename Backend, multiprecision::expression_template_option ExpressionTemplates>
                         constexpr element_fp
                             pow(const multiprecision::number<Backend, ExpressionTemplates> &pwr) const {
-                            return element_fp(multiprecision::powm(data, pwr));
+                            return power(*this, pwr);
                         }
                     };
 
@@ -235,6 +247,10 @@ namespace nil {
                     template<typename FieldParams>
                     constexpr typename element_fp<FieldParams>::modular_params_type const element_fp<FieldParams>::modulus_params;
 
+                    template<typename FieldParams>
+                    constexpr typename element_fp<FieldParams>::exponent_chain_type const
+                        element_fp<FieldParams>::sqrt_exponent_chain;
+
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
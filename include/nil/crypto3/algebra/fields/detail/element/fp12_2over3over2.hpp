@@ -31,6 +31,9 @@
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/wnaf.hpp>
+
+#include <vector>
 
 namespace nil {
     namespace crypto3 {
@@ -244,6 +247,11 @@ namespace nil {
                             return element_fp12_2over3over2(underlying_type(z0, z4, z3), underlying_type(z2, z1, z5));
                         }
 
+                        /*
+                         * Signed-digit window exponentiation for elements of the cyclotomic subgroup:
+                         * squarings are cyclotomic_squared() and negative wNAF digits are served by
+                         * conjugating the precomputed odd powers, which is free there.
+                         */
                         template<typename PowerType>
                         element_fp12_2over3over2 cyclotomic_exp(const PowerType &exponent) const {
                             element_fp12_2over3over2 res = one();
@@ -251,20 +259,40 @@ namespace nil {
                             if (exponent == 0)
                                 return res;
 
-                            bool found_one = false;
-                            for (long i = nil::crypto3::multiprecision::msb(exponent); i >= 0; --i) {
-                                if (found_one) {
+                            const std::size_t window =
+                                power_window_size(nil::crypto3::multiprecision::msb(exponent) + 1);
+                            std::vector<long> naf = nil::crypto3::multiprecision::find_wnaf(window, exponent);
+
+                            std::vector<element_fp12_2over3over2> table(1ul << (window - 1));
+                            const element_fp12_2over3over2 squared_this = this->cyclotomic_squared();
+                            table[0] = *this;
+                            for (std::size_t i = 1; i < table.size(); ++i) {
+                                table[i] = table[i - 1] * squared_this;
+                            }
+
+                            bool found_nonzero = false;
+                            for (long i = static_cast<long>(naf.size() - 1); i >= 0; --i) {
+                                if (found_nonzero) {
                                     res = res.cyclotomic_squared();
                                 }
 
-                                if (nil::crypto3::multiprecision::bit_test(exponent, i)) {
-                                    found_one = true;
-                                    res = res * (*this);
+                                if (naf[i] != 0) {
+                                    found_nonzero = true;
+
+                                    if (naf[i] > 0) {
+                                        res = res * table[naf[i] / 2];
+                                    } else {
+                                        res = res * table[(-naf[i]) / 2].unitary_inversed();
+                                    }
                                 }
                             }
 
                             return res;
-                            // return *this;
+                        }
+
+                        template<std::size_t Bits, std::size_t Window>
+                        element_fp12_2over3over2 cyclotomic_exp(const fixed_exponent_chain<Bits, Window> &chain) const {
+                            return power(*this, chain, cyclotomic_squaring());
                         }
 
                         element_fp12_2over3over2
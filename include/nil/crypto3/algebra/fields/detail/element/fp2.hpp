@@ -51,6 +51,10 @@ namespace nil {
 
                         typedef typename policy_type::underlying_type underlying_type;
 
+                        typedef fixed_exponent_chain<2 * policy_type::modulus_bits> exponent_chain_type;
+                        constexpr static const exponent_chain_type t_minus_1_over_2_chain =
+                            exponent_chain_type(policy_type::t_minus_1_over_2);
+
                         using data_type = std::array<underlying_type, 2>;
 
                         data_type data;
@@ -210,7 +214,7 @@ namespace nil {
 
                             std::size_t v = policy_type::s;
                             element_fp2 z(policy_type::nqr_to_t[0], policy_type::nqr_to_t[1]);
-                            element_fp2 w = this->pow(policy_type::t_minus_1_over_2);
+                            element_fp2 w = power(*this, t_minus_1_over_2_chain);
                             element_fp2 x((*this) * w);
                             element_fp2 b = x * w;    // b = (*this)^t
 
@@ -254,9 +258,12 @@ namespace nil {
                             return element_fp2((A + B) * (A + non_residue * B) - AB - non_residue * AB, AB + AB);
                         }
 
+                        /*
+                         * x is a square in Fp2 iff its norm x0^2 - non_residue * x1^2 is a square in Fp,
+                         * which reduces the test to a single Legendre symbol in the base field.
+                         */
                         constexpr bool is_square() const {
-                            element_fp2 tmp = this->pow(policy_type::group_order);
-                            return (tmp.is_one() || tmp.is_zero());    // maybe can be done more effective
+                            return (data[0].squared() - non_residue * data[1].squared()).is_square();
                         }
 
                         template<typename PowerType>
@@ -317,6 +324,10 @@ namespace nil {
                     constexpr const typename element_fp2<FieldParams>::non_residue_type
                         element_fp2<FieldParams>::non_residue;
 
+                    template<typename FieldParams>
+                    constexpr const typename element_fp2<FieldParams>::exponent_chain_type
+                        element_fp2<FieldParams>::t_minus_1_over_2_chain;
+
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
@@ -51,6 +51,10 @@ namespace nil {
 
                         typedef typename policy_type::underlying_type underlying_type;
 
+                        typedef fixed_exponent_chain<3 * policy_type::modulus_bits> exponent_chain_type;
+                        constexpr static const exponent_chain_type t_minus_1_over_2_chain =
+                            exponent_chain_type(policy_type::t_minus_1_over_2);
+
                         using data_type = std::array<underlying_type, 3>;
 
                         data_type data;
@@ -162,7 +166,7 @@ namespace nil {
 
                             std::size_t v = policy_type::s;
                             element_fp3 z(policy_type::nqr_to_t[0], policy_type::nqr_to_t[1], policy_type::nqr_to_t[2]);
-                            element_fp3 w = this->pow(policy_type::t_minus_1_over_2);
+                            element_fp3 w = power(*this, t_minus_1_over_2_chain);
                             element_fp3 x((*this) * w);
                             element_fp3 b = x * w;    // b = (*this)^t
 
@@ -198,9 +202,18 @@ namespace nil {
                             return (*this) * (*this);    // maybe can be done more effective
                         }
 
+                        /*
+                         * Same as for Fp2: the quadratic character of x equals the one of its norm
+                         * x0^3 + non_residue * x1^3 + non_residue^2 * x2^3 - 3 * non_residue * x0 * x1 * x2.
+                         */
                         constexpr bool is_square() const {
-                            element_fp3 tmp = this->pow((policy_type::group_order - 1) / 2);
-                            return (tmp.is_one() || tmp.is_zero());    // maybe can be done more effective
+                            const underlying_type &A0 = data[0], &A1 = data[1], &A2 = data[2];
+
+                            const underlying_type norm = A0 * A0.squared() + non_residue * A1 * A1.squared() +
+                                                         non_residue.squared() * A2 * A2.squared() -
+                                                         underlying_type(3) * non_residue * A0 * A1 * A2;
+
+                            return norm.is_square();
                         }
 
                         template<typename PowerType>
@@ -259,6 +272,10 @@ namespace nil {
                     constexpr const typename element_fp3<FieldParams>::non_residue_type
                         element_fp3<FieldParams>::non_residue;
 
+                    template<typename FieldParams>
+                    constexpr const typename element_fp3<FieldParams>::exponent_chain_type
+                        element_fp3<FieldParams>::t_minus_1_over_2_chain;
+
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
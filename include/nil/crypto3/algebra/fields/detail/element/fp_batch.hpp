@@ -0,0 +1,271 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_BATCH_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_BATCH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+#include <nil/crypto3/algebra/fields/detail/montgomery_lanes.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /*!
+                     * @brief Lanes independent elements of F[p] operated on together.
+                     *
+                     * Elements are held in Montgomery form with 52-bit limbs, so a multiplication of
+                     * two batches runs the AVX-512 IFMA kernel of montgomery_lanes when the CPU has
+                     * it (Lanes a multiple of 8), the AVX2 one (Lanes a multiple of 4) and the portable
+                     * reference otherwise. Meant for bulk work (bucket sums,
+                     * batch inversion, polynomial arithmetic), convert with get()/set() at the edges.
+                     */
+                    template<typename FieldParams, std::size_t Lanes = 8>
+                    class element_fp_batch {
+                        typedef FieldParams policy_type;
+
+                    public:
+                        typedef typename policy_type::field_type field_type;
+                        typedef typename policy_type::integral_type integral_type;
+                        typedef element_fp<FieldParams> value_type;
+
+                        constexpr static const std::size_t lanes = Lanes;
+                        constexpr static const std::size_t limb_bits = 52;
+                        // one spare bit keeps 2p below 2^(52 * limbs)
+                        constexpr static const std::size_t limbs = (policy_type::modulus_bits + limb_bits) / limb_bits;
+
+                        typedef montgomery_lanes<limbs, Lanes> lanes_type;
+                        typedef montgomery_lanes<limbs, 1> single_type;
+                        typedef typename lanes_type::data_type data_type;
+
+                        data_type data;
+
+                        element_fp_batch() : data {} {
+                        }
+
+                        element_fp_batch(const value_type &x) : data {} {
+                            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                                set(lane, x);
+                            }
+                        }
+
+                        element_fp_batch(const std::array<value_type, Lanes> &in_data) : data {} {
+                            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                                set(lane, in_data[lane]);
+                            }
+                        }
+
+                        template<typename InputIterator>
+                        element_fp_batch(InputIterator first, InputIterator last) : data {} {
+                            for (std::size_t lane = 0; lane < Lanes && first != last; ++lane, ++first) {
+                                set(lane, *first);
+                            }
+                        }
+
+                        static element_fp_batch zero() {
+                            return element_fp_batch();
+                        }
+
+                        static element_fp_batch one() {
+                            element_fp_batch result;
+                            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                                for (std::size_t i = 0; i < limbs; ++i) {
+                                    result.data[i][lane] = constants().one[i];
+                                }
+                            }
+                            return result;
+                        }
+
+                        void set(std::size_t lane, const value_type &x) {
+                            BOOST_ASSERT(lane < Lanes);
+
+                            const integral_type value = x.data.template convert_to<integral_type>();
+
+                            typename single_type::data_type plain {}, r2 {};
+                            for (std::size_t i = 0; i < limbs; ++i) {
+                                plain[i][0] = limb(value, i);
+                                r2[i][0] = constants().r2[i];
+                            }
+
+                            single_type::mul_reference(plain, plain, r2, constants().modulus, constants().n0);
+                            for (std::size_t i = 0; i < limbs; ++i) {
+                                data[i][lane] = plain[i][0];
+                            }
+                        }
+
+                        value_type get(std::size_t lane) const {
+                            BOOST_ASSERT(lane < Lanes);
+
+                            typename single_type::data_type mont {}, unit {};
+                            for (std::size_t i = 0; i < limbs; ++i) {
+                                mont[i][0] = data[i][lane];
+                            }
+                            unit[0][0] = 1;
+
+                            single_type::mul_reference(mont, mont, unit, constants().modulus, constants().n0);
+
+                            integral_type value = 0;
+                            for (std::size_t i = limbs; i-- > 0;) {
+                                value <<= limb_bits;
+                                value |= integral_type(mont[i][0]);
+                            }
+                            return value_type(value);
+                        }
+
+                        value_type operator[](std::size_t lane) const {
+                            return get(lane);
+                        }
+
+                        template<typename OutputIterator>
+                        OutputIterator store(OutputIterator out) const {
+                            for (std::size_t lane = 0; lane < Lanes; ++lane, ++out) {
+                                *out = get(lane);
+                            }
+                            return out;
+                        }
+
+                        bool operator==(const element_fp_batch &B) const {
+                            return data == B.data;
+                        }
+
+                        bool operator!=(const element_fp_batch &B) const {
+                            return data != B.data;
+                        }
+
+                        element_fp_batch operator+(const element_fp_batch &B) const {
+                            element_fp_batch result;
+                            lanes_type::add(result.data, data, B.data, constants().modulus);
+                            return result;
+                        }
+
+                        element_fp_batch operator-(const element_fp_batch &B) const {
+                            element_fp_batch result;
+                            lanes_type::sub(result.data, data, B.data, constants().modulus);
+                            return result;
+                        }
+
+                        element_fp_batch operator-() const {
+                            return zero() - *this;
+                        }
+
+                        element_fp_batch operator*(const element_fp_batch &B) const {
+                            element_fp_batch result;
+                            lanes_type::mul(result.data, data, B.data, constants().modulus, constants().n0);
+                            return result;
+                        }
+
+                        element_fp_batch &operator+=(const element_fp_batch &B) {
+                            lanes_type::add(data, data, B.data, constants().modulus);
+                            return *this;
+                        }
+
+                        element_fp_batch &operator-=(const element_fp_batch &B) {
+                            lanes_type::sub(data, data, B.data, constants().modulus);
+                            return *this;
+                        }
+
+                        element_fp_batch &operator*=(const element_fp_batch &B) {
+                            lanes_type::mul(data, data, B.data, constants().modulus, constants().n0);
+                            return *this;
+                        }
+
+                        element_fp_batch doubled() const {
+                            return *this + *this;
+                        }
+
+                        element_fp_batch squared() const {
+                            return *this * *this;
+                        }
+
+                    private:
+                        struct constants_type {
+                            typename lanes_type::modulus_type modulus;
+                            typename lanes_type::modulus_type one;    // 2^(52 * limbs) mod p
+                            typename lanes_type::modulus_type r2;     // 2^(104 * limbs) mod p
+                            std::uint64_t n0;                         // -p^-1 mod 2^52
+                        };
+
+                        static std::uint64_t limb(const integral_type &value, std::size_t i) {
+                            return ((value >> (limb_bits * i)) & integral_type(lanes_type::limb_mask))
+                                .template convert_to<std::uint64_t>();
+                        }
+
+                        static constants_type make_constants() {
+                            constants_type result;
+
+                            for (std::size_t i = 0; i < limbs; ++i) {
+                                result.modulus[i] = limb(policy_type::modulus, i);
+                            }
+
+                            // Newton iteration for p^-1 mod 2^64, each step doubles the correct bits
+                            std::uint64_t inv = 1;
+                            for (std::size_t i = 0; i < 6; ++i) {
+                                inv *= 2 - result.modulus[0] * inv;
+                            }
+                            result.n0 = (0 - inv) & lanes_type::limb_mask;
+
+                            // R mod p and R^2 mod p by repeated modular doubling of 1
+                            typename single_type::data_type x {};
+                            x[0][0] = 1;
+                            for (std::size_t i = 0; i < 2 * limb_bits * limbs; ++i) {
+                                single_type::add(x, x, x, result.modulus);
+                                if (i + 1 == limb_bits * limbs) {
+                                    for (std::size_t j = 0; j < limbs; ++j) {
+                                        result.one[j] = x[j][0];
+                                    }
+                                }
+                            }
+                            for (std::size_t j = 0; j < limbs; ++j) {
+                                result.r2[j] = x[j][0];
+                            }
+
+                            return result;
+                        }
+
+                        static const constants_type &constants() {
+                            static const constants_type result = make_constants();
+                            return result;
+                        }
+                    };
+
+                    template<typename FieldParams, std::size_t Lanes>
+                    constexpr std::size_t const element_fp_batch<FieldParams, Lanes>::lanes;
+
+                    template<typename FieldParams, std::size_t Lanes>
+                    constexpr std::size_t const element_fp_batch<FieldParams, Lanes>::limbs;
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_BATCH_HPP
@@ -27,6 +27,7 @@
 #ifndef CRYPTO3_ALGEBRA_FIELDS_POWER_HPP
 #define CRYPTO3_ALGEBRA_FIELDS_POWER_HPP
 
+#include <cstddef>
 #include <cstdint>
 
 #include <nil/crypto3/multiprecision/number.hpp>
@@ -37,26 +38,219 @@ namespace nil {
         namespace algebra {
             namespace fields {
                 namespace detail {
-                    template<typename FieldValueType, typename NumberType>
-                    constexpr FieldValueType power(const FieldValueType &base, const NumberType &exponent) {
+                    struct field_squaring {
+                        template<typename FieldValueType>
+                        constexpr FieldValueType operator()(const FieldValueType &x) const {
+                            return x.squared();
+                        }
+                    };
+
+                    struct cyclotomic_squaring {
+                        template<typename FieldValueType>
+                        constexpr FieldValueType operator()(const FieldValueType &x) const {
+                            return x.cyclotomic_squared();
+                        }
+                    };
+
+                    constexpr std::size_t max_power_window = 5;
+
+                    /*!
+                     * @brief Window size minimizing the multiplication count of a sliding-window
+                     * exponentiation by an exponent of the given bit length.
+                     */
+                    constexpr std::size_t power_window_size(std::size_t exponent_bits) {
+                        if (exponent_bits <= 10) {
+                            return 1;
+                        }
+                        if (exponent_bits <= 24) {
+                            return 2;
+                        }
+                        if (exponent_bits <= 80) {
+                            return 3;
+                        }
+                        if (exponent_bits <= 240) {
+                            return 4;
+                        }
+                        return max_power_window;
+                    }
+
+                    /*!
+                     * @brief Left-to-right sliding-window exponentiation.
+                     *
+                     * Runs of zero bits only cost squarings, and every nonzero window of at most
+                     * window bits costs one multiplication by a precomputed odd power of base.
+                     */
+                    template<typename FieldValueType, typename NumberType, typename Square = field_squaring>
+                    constexpr FieldValueType sliding_window_power(const FieldValueType &base, const NumberType &exponent,
+                                                                  std::size_t window, const Square &square = Square()) {
                         FieldValueType result = FieldValueType::one();
 
                         if (exponent == 0)
                             return result;
 
+                        if (window == 0 || window > max_power_window) {
+                            window = max_power_window;
+                        }
+
+                        // base^1, base^3, ..., base^(2^window - 1)
+                        FieldValueType odd_powers[std::size_t(1) << (max_power_window - 1)];
+                        odd_powers[0] = base;
+                        if (window > 1) {
+                            const FieldValueType base_squared = square(base);
+                            for (std::size_t k = 1; k < (std::size_t(1) << (window - 1)); ++k) {
+                                odd_powers[k] = odd_powers[k - 1] * base_squared;
+                            }
+                        }
+
                         bool found_one = false;
+                        long i = nil::crypto3::multiprecision::msb(exponent);
+
+                        while (i >= 0) {
+                            if (!nil::crypto3::multiprecision::bit_test(exponent, i)) {
+                                if (found_one) {
+                                    result = square(result);
+                                }
+                                --i;
+                                continue;
+                            }
+
+                            long j = i - static_cast<long>(window) + 1;
+                            if (j < 0) {
+                                j = 0;
+                            }
+                            while (!nil::crypto3::multiprecision::bit_test(exponent, j)) {
+                                ++j;
+                            }
+
+                            std::size_t digit = 0;
+                            for (long k = i; k >= j; --k) {
+                                digit = (digit << 1) | (nil::crypto3::multiprecision::bit_test(exponent, k) ? 1 : 0);
+                                if (found_one) {
+                                    result = square(result);
+                                }
+                            }
+
+                            result = found_one ? result * odd_powers[digit >> 1] : odd_powers[digit >> 1];
+                            found_one = true;
+
+                            i = j - 1;
+                        }
+
+                        return result;
+                    }
+
+                    template<typename FieldValueType, typename NumberType>
+                    constexpr FieldValueType power(const FieldValueType &base, const NumberType &exponent) {
+                        if (exponent == 0)
+                            return FieldValueType::one();
+
+                        return sliding_window_power(
+                            base, exponent, power_window_size(nil::crypto3::multiprecision::msb(exponent) + 1));
+                    }
 
-                        for (long i = nil::crypto3::multiprecision::msb(exponent); i >= 0; --i) {
-                            if (found_one) {
-                                result = result.squared();
+                    /*!
+                     * @brief Sliding-window addition chain for an exponent known at compile time.
+                     *
+                     * The exponent is recoded once, from the most significant bit down, into steps
+                     * "square k times, then multiply by base^d" with odd d < 2^Window. Declared as a
+                     * constexpr static member next to the exponent it is built from, the recoding is
+                     * evaluated by the compiler and every exponentiation by it only replays the chain.
+                     * Bits bounds the bit length of the exponent.
+                     */
+                    template<std::size_t Bits, std::size_t Window = 4>
+                    struct fixed_exponent_chain {
+                        static_assert(Window > 0 && Window < 16, "unsupported window size");
+
+                        constexpr static const std::size_t window = Window;
+
+                        std::size_t length;
+                        std::size_t trailing_squarings;
+                        std::size_t max_digit;
+                        std::uint16_t squarings[Bits];
+                        std::uint16_t digits[Bits];
+
+                        template<typename NumberType>
+                        constexpr fixed_exponent_chain(const NumberType &exponent) :
+                            length(0), trailing_squarings(0), max_digit(0), squarings {}, digits {} {
+
+                            if (exponent == 0) {
+                                return;
                             }
 
-                            if (nil::crypto3::multiprecision::bit_test(exponent, i)) {
-                                found_one = true;
-                                result = result * base;
+                            std::size_t pending = 0;
+                            long i = nil::crypto3::multiprecision::msb(exponent);
+
+                            while (i >= 0) {
+                                if (!nil::crypto3::multiprecision::bit_test(exponent, i)) {
+                                    ++pending;
+                                    --i;
+                                    continue;
+                                }
+
+                                long j = i - static_cast<long>(Window) + 1;
+                                if (j < 0) {
+                                    j = 0;
+                                }
+                                while (!nil::crypto3::multiprecision::bit_test(exponent, j)) {
+                                    ++j;
+                                }
+
+                                std::size_t digit = 0;
+                                for (long k = i; k >= j; --k) {
+                                    digit = (digit << 1) | (nil::crypto3::multiprecision::bit_test(exponent, k) ? 1 : 0);
+                                }
+
+                                squarings[length] = static_cast<std::uint16_t>(pending + (i - j + 1));
+                                digits[length] = static_cast<std::uint16_t>(digit >> 1);
+                                if ((digit >> 1) > max_digit) {
+                                    max_digit = digit >> 1;
+                                }
+                                ++length;
+
+                                pending = 0;
+                                i = j - 1;
+                            }
+
+                            trailing_squarings = pending;
+                        }
+                    };
+
+                    /*!
+                     * @brief Replays a fixed_exponent_chain. Square is the squaring to use, so that
+                     * elements of a cyclotomic subgroup can supply their compressed squaring.
+                     */
+                    template<typename FieldValueType, std::size_t Bits, std::size_t Window,
+                             typename Square = field_squaring>
+                    constexpr FieldValueType power(const FieldValueType &base,
+                                                   const fixed_exponent_chain<Bits, Window> &chain,
+                                                   const Square &square = Square()) {
+                        if (chain.length == 0) {
+                            return FieldValueType::one();
+                        }
+
+                        // base^1, base^3, ..., base^(2 * max_digit + 1)
+                        FieldValueType odd_powers[std::size_t(1) << (Window - 1)];
+                        odd_powers[0] = base;
+                        if (chain.max_digit > 0) {
+                            const FieldValueType base_squared = square(base);
+                            for (std::size_t k = 1; k <= chain.max_digit; ++k) {
+                                odd_powers[k] = odd_powers[k - 1] * base_squared;
                             }
                         }
 
+                        FieldValueType result = odd_powers[chain.digits[0]];
+
+                        for (std::size_t step = 1; step < chain.length; ++step) {
+                            for (std::size_t k = 0; k < chain.squarings[step]; ++k) {
+                                result = square(result);
+                            }
+                            result = result * odd_powers[chain.digits[step]];
+                        }
+
+                        for (std::size_t k = 0; k < chain.trailing_squarings; ++k) {
+                            result = square(result);
+                        }
+
                         return result;
                     }
                 }    // namespace detail
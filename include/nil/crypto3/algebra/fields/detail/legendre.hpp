@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_LEGENDRE_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_LEGENDRE_HPP
+
+#include <cstddef>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /*!
+                     * @brief Jacobi symbol (a/n) for an odd positive n and 0 <= a < n.
+                     *
+                     * Binary variant: only shifts, subtractions and comparisons of the fixed-width
+                     * representation are used, so no modular reduction or exponentiation is involved.
+                     * For a prime n it is the Legendre symbol, i.e. 1 for nonzero squares, -1 for
+                     * non-squares and 0 for a == 0.
+                     */
+                    template<typename NumberType>
+                    constexpr int jacobi_symbol(NumberType a, NumberType n) {
+                        int result = 1;
+
+                        while (a != 0) {
+                            std::size_t twos = nil::crypto3::multiprecision::lsb(a);
+                            a >>= twos;
+
+                            // (2/n) = -1 iff n = 3, 5 (mod 8)
+                            if ((twos & 1) && (nil::crypto3::multiprecision::bit_test(n, 1) !=
+                                               nil::crypto3::multiprecision::bit_test(n, 2))) {
+                                result = -result;
+                            }
+
+                            // both a and n are odd here, quadratic reciprocity applies
+                            if (a < n) {
+                                NumberType tmp = a;
+                                a = n;
+                                n = tmp;
+                                if (nil::crypto3::multiprecision::bit_test(a, 1) &&
+                                    nil::crypto3::multiprecision::bit_test(n, 1)) {
+                                    result = -result;
+                                }
+                            }
+
+                            a -= n;
+                        }
+
+                        return n == 1 ? result : 0;
+                    }
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_LEGENDRE_HPP
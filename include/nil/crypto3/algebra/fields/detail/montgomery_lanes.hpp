@@ -0,0 +1,393 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_MONTGOMERY_LANES_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_MONTGOMERY_LANES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(CRYPTO3_ALGEBRA_DISABLE_SIMD)
+#define CRYPTO3_ALGEBRA_HAS_AVX512IFMA_KERNEL
+#define CRYPTO3_ALGEBRA_HAS_AVX2_KERNEL
+#include <immintrin.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /*!
+                     * @brief Montgomery arithmetic on Lanes independent residues at once.
+                     *
+                     * Residues are kept in radix 2^52, structure-of-arrays: limb i of every lane is
+                     * stored contiguously in data[i], which is the layout 52-bit multiply-add
+                     * instructions consume directly. Inputs and outputs are fully reduced (< p),
+                     * 2p must fit in Limbs limbs.
+                     */
+                    template<std::size_t Limbs, std::size_t Lanes>
+                    struct montgomery_lanes {
+                        constexpr static const std::size_t limbs = Limbs;
+                        constexpr static const std::size_t lanes = Lanes;
+                        constexpr static const std::size_t limb_bits = 52;
+                        constexpr static const std::uint64_t limb_mask = (std::uint64_t(1) << limb_bits) - 1;
+
+                        typedef std::array<std::array<std::uint64_t, Lanes>, Limbs> data_type;
+                        typedef std::array<std::uint64_t, Limbs> modulus_type;
+
+                        static void add(data_type &r, const data_type &a, const data_type &b,
+                                        const modulus_type &p) {
+                            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                                std::uint64_t carry = 0;
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    std::uint64_t s = a[i][lane] + b[i][lane] + carry;
+                                    r[i][lane] = s & limb_mask;
+                                    carry = s >> limb_bits;
+                                }
+                                reduce_once(r, lane, p);
+                            }
+                        }
+
+                        static void sub(data_type &r, const data_type &a, const data_type &b,
+                                        const modulus_type &p) {
+                            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                                std::uint64_t borrow = 0;
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    std::uint64_t d = a[i][lane] - b[i][lane] - borrow;
+                                    r[i][lane] = d & limb_mask;
+                                    borrow = d >> 63;
+                                }
+                                if (borrow) {
+                                    std::uint64_t carry = 0;
+                                    for (std::size_t i = 0; i < Limbs; ++i) {
+                                        std::uint64_t s = r[i][lane] + p[i] + carry;
+                                        r[i][lane] = s & limb_mask;
+                                        carry = s >> limb_bits;
+                                    }
+                                }
+                            }
+                        }
+
+                        /*!
+                         * @brief Scalar reference: per-lane CIOS Montgomery multiplication,
+                         * r = a * b / 2^(52 * Limbs) mod p. n0 is -p^-1 mod 2^52.
+                         */
+                        static void mul_reference(data_type &r, const data_type &a, const data_type &b,
+                                                  const modulus_type &p, std::uint64_t n0) {
+                            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                                std::uint64_t t[Limbs + 1] = {};
+
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    std::uint64_t carry = 0;
+                                    for (std::size_t j = 0; j < Limbs; ++j) {
+                                        t[j] = mul_add(a[j][lane], b[i][lane], t[j] + carry, carry);
+                                    }
+                                    t[Limbs] += carry;
+
+                                    const std::uint64_t m = (t[0] * n0) & limb_mask;
+                                    mul_add(m, p[0], t[0], carry);
+                                    for (std::size_t j = 1; j < Limbs; ++j) {
+                                        t[j - 1] = mul_add(m, p[j], t[j] + carry, carry);
+                                    }
+                                    const std::uint64_t s = t[Limbs] + carry;
+                                    t[Limbs - 1] = s & limb_mask;
+                                    t[Limbs] = s >> limb_bits;
+                                }
+
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    r[i][lane] = t[i];
+                                }
+                                reduce_once(r, lane, p);
+                            }
+                        }
+
+#ifdef CRYPTO3_ALGEBRA_HAS_AVX512IFMA_KERNEL
+                        /*!
+                         * @brief AVX-512 IFMA kernel, eight lanes per pass. Partial products are
+                         * accumulated unnormalized in 64-bit lanes and carries are resolved once at
+                         * the end, so the inner loops are pure vpmadd52luq/vpmadd52huq chains.
+                         */
+                        __attribute__((target("avx512f,avx512ifma"))) static void
+                            mul_avx512ifma(data_type &r, const data_type &a, const data_type &b,
+                                           const modulus_type &p, std::uint64_t n0) {
+                            static_assert(Lanes % 8 == 0, "IFMA kernel works on groups of eight lanes");
+
+                            const __m512i zero = _mm512_setzero_si512();
+                            const __m512i mask = _mm512_set1_epi64(limb_mask);
+                            const __m512i n0v = _mm512_set1_epi64(n0);
+
+                            __m512i pv[Limbs];
+                            for (std::size_t i = 0; i < Limbs; ++i) {
+                                pv[i] = _mm512_set1_epi64(p[i]);
+                            }
+
+                            for (std::size_t group = 0; group < Lanes; group += 8) {
+                                __m512i av[Limbs], t[Limbs + 1];
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    av[i] = _mm512_loadu_si512(&a[i][group]);
+                                    t[i] = zero;
+                                }
+                                t[Limbs] = zero;
+
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    const __m512i bi = _mm512_loadu_si512(&b[i][group]);
+                                    for (std::size_t j = 0; j < Limbs; ++j) {
+                                        t[j] = _mm512_madd52lo_epu64(t[j], av[j], bi);
+                                        t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], av[j], bi);
+                                    }
+
+                                    const __m512i m = _mm512_madd52lo_epu64(zero, t[0], n0v);
+                                    for (std::size_t j = 0; j < Limbs; ++j) {
+                                        t[j] = _mm512_madd52lo_epu64(t[j], m, pv[j]);
+                                        t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, pv[j]);
+                                    }
+
+                                    // the low 52 bits of t[0] are zero now, shift one limb down
+                                    t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], limb_bits));
+                                    for (std::size_t j = 0; j < Limbs; ++j) {
+                                        t[j] = t[j + 1];
+                                    }
+                                    t[Limbs] = zero;
+                                }
+
+                                // normalize to 52-bit limbs
+                                __m512i carry = zero;
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    t[i] = _mm512_add_epi64(t[i], carry);
+                                    carry = _mm512_srli_epi64(t[i], limb_bits);
+                                    t[i] = _mm512_and_si512(t[i], mask);
+                                }
+
+                                // conditional subtraction of p
+                                __m512i d[Limbs];
+                                __m512i borrow = zero;
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    d[i] = _mm512_sub_epi64(_mm512_sub_epi64(t[i], pv[i]), borrow);
+                                    borrow = _mm512_srli_epi64(d[i], 63);
+                                    d[i] = _mm512_and_si512(d[i], mask);
+                                }
+                                const __mmask8 keep = _mm512_cmpneq_epi64_mask(borrow, zero);
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    _mm512_storeu_si512(&r[i][group], _mm512_mask_blend_epi64(keep, d[i], t[i]));
+                                }
+                            }
+                        }
+#endif
+
+#ifdef CRYPTO3_ALGEBRA_HAS_AVX2_KERNEL
+                        /*!
+                         * @brief AVX2 kernel, four lanes per pass. AVX2 only multiplies 32-bit halves, so each
+                         * 52-bit product is assembled from four vpmuludq on 26-bit halves and carries are
+                         * propagated after every product, as in mul_reference.
+                         */
+                        __attribute__((target("avx2"))) static void mul_avx2(data_type &r, const data_type &a,
+                                                                             const data_type &b,
+                                                                             const modulus_type &p,
+                                                                             std::uint64_t n0) {
+                            static_assert(Lanes % 4 == 0, "AVX2 kernel works on groups of four lanes");
+
+                            const __m256i zero = _mm256_setzero_si256();
+                            const __m256i mask = _mm256_set1_epi64x(limb_mask);
+                            const __m256i n0v = _mm256_set1_epi64x(n0);
+
+                            __m256i pv[Limbs];
+                            for (std::size_t i = 0; i < Limbs; ++i) {
+                                pv[i] = _mm256_set1_epi64x(p[i]);
+                            }
+
+                            for (std::size_t group = 0; group < Lanes; group += 4) {
+                                __m256i av[Limbs], t[Limbs + 1];
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    av[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&a[i][group]));
+                                    t[i] = zero;
+                                }
+                                t[Limbs] = zero;
+
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    const __m256i bi =
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&b[i][group]));
+                                    __m256i carry = zero;
+                                    for (std::size_t j = 0; j < Limbs; ++j) {
+                                        t[j] = mul_add_avx2(av[j], bi, _mm256_add_epi64(t[j], carry), carry);
+                                    }
+                                    t[Limbs] = _mm256_add_epi64(t[Limbs], carry);
+
+                                    __m256i unused;
+                                    const __m256i m = mul_add_avx2(t[0], n0v, zero, unused);
+                                    mul_add_avx2(m, pv[0], t[0], carry);
+                                    for (std::size_t j = 1; j < Limbs; ++j) {
+                                        t[j - 1] = mul_add_avx2(m, pv[j], _mm256_add_epi64(t[j], carry), carry);
+                                    }
+                                    const __m256i s = _mm256_add_epi64(t[Limbs], carry);
+                                    t[Limbs - 1] = _mm256_and_si256(s, mask);
+                                    t[Limbs] = _mm256_srli_epi64(s, limb_bits);
+                                }
+
+                                // conditional subtraction of p
+                                __m256i d[Limbs];
+                                __m256i borrow = zero;
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    d[i] = _mm256_sub_epi64(_mm256_sub_epi64(t[i], pv[i]), borrow);
+                                    borrow = _mm256_srli_epi64(d[i], 63);
+                                    d[i] = _mm256_and_si256(d[i], mask);
+                                }
+                                const __m256i keep = _mm256_sub_epi64(zero, borrow);
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&r[i][group]),
+                                                        _mm256_or_si256(_mm256_and_si256(keep, t[i]),
+                                                                        _mm256_andnot_si256(keep, d[i])));
+                                }
+                            }
+                        }
+#endif
+
+                        static void mul(data_type &r, const data_type &a, const data_type &b, const modulus_type &p,
+                                        std::uint64_t n0) {
+#ifdef CRYPTO3_ALGEBRA_HAS_AVX512IFMA_KERNEL
+                            if (Lanes % 8 == 0 && has_avx512ifma()) {
+                                mul_avx512ifma_dispatch(r, a, b, p, n0, std::integral_constant<bool, Lanes % 8 == 0>());
+                                return;
+                            }
+#endif
+#ifdef CRYPTO3_ALGEBRA_HAS_AVX2_KERNEL
+                            if (Lanes % 4 == 0 && has_avx2()) {
+                                mul_avx2_dispatch(r, a, b, p, n0, std::integral_constant<bool, Lanes % 4 == 0>());
+                                return;
+                            }
+#endif
+                            mul_reference(r, a, b, p, n0);
+                        }
+
+                        static bool has_avx512ifma() {
+#ifdef CRYPTO3_ALGEBRA_HAS_AVX512IFMA_KERNEL
+                            static const bool supported =
+                                __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+                            return supported;
+#else
+                            return false;
+#endif
+                        }
+
+                        static bool has_avx2() {
+#ifdef CRYPTO3_ALGEBRA_HAS_AVX2_KERNEL
+                            static const bool supported = __builtin_cpu_supports("avx2");
+                            return supported;
+#else
+                            return false;
+#endif
+                        }
+
+                    private:
+                        /// a * b + c = hi * 2^52 + lo with lo < 2^52 returned, for a, b < 2^52
+                        static inline std::uint64_t mul_add(std::uint64_t a, std::uint64_t b, std::uint64_t c,
+                                                            std::uint64_t &hi) {
+#ifdef __SIZEOF_INT128__
+                            __extension__ typedef unsigned __int128 double_limb_type;
+
+                            const double_limb_type s = double_limb_type(a) * b + c;
+                            hi = std::uint64_t(s >> limb_bits);
+                            return std::uint64_t(s) & limb_mask;
+#else
+                            // a * b = a1 * b1 * 2^52 + (a0 * b1 + a1 * b0) * 2^26 + a0 * b0 on 26-bit halves
+                            const std::uint64_t half_mask = (std::uint64_t(1) << (limb_bits / 2)) - 1;
+                            const std::uint64_t a0 = a & half_mask, a1 = a >> (limb_bits / 2);
+                            const std::uint64_t b0 = b & half_mask, b1 = b >> (limb_bits / 2);
+
+                            const std::uint64_t mid = a0 * b1 + a1 * b0;
+                            const std::uint64_t lo = a0 * b0 + ((mid & half_mask) << (limb_bits / 2)) + (c & limb_mask);
+                            hi = a1 * b1 + (mid >> (limb_bits / 2)) + (c >> limb_bits) + (lo >> limb_bits);
+                            return lo & limb_mask;
+#endif
+                        }
+
+#ifdef CRYPTO3_ALGEBRA_HAS_AVX2_KERNEL
+                        /// mul_add on four lanes
+                        __attribute__((target("avx2"))) static inline __m256i
+                            mul_add_avx2(__m256i a, __m256i b, __m256i c, __m256i &hi) {
+                            const __m256i half_mask = _mm256_set1_epi64x((std::uint64_t(1) << (limb_bits / 2)) - 1);
+                            const __m256i mask = _mm256_set1_epi64x(limb_mask);
+
+                            const __m256i a0 = _mm256_and_si256(a, half_mask), a1 = _mm256_srli_epi64(a, limb_bits / 2);
+                            const __m256i b0 = _mm256_and_si256(b, half_mask), b1 = _mm256_srli_epi64(b, limb_bits / 2);
+
+                            const __m256i mid = _mm256_add_epi64(_mm256_mul_epu32(a0, b1), _mm256_mul_epu32(a1, b0));
+                            const __m256i lo = _mm256_add_epi64(
+                                _mm256_add_epi64(_mm256_mul_epu32(a0, b0),
+                                                 _mm256_slli_epi64(_mm256_and_si256(mid, half_mask), limb_bits / 2)),
+                                _mm256_and_si256(c, mask));
+                            hi = _mm256_add_epi64(
+                                _mm256_add_epi64(_mm256_mul_epu32(a1, b1), _mm256_srli_epi64(mid, limb_bits / 2)),
+                                _mm256_add_epi64(_mm256_srli_epi64(c, limb_bits), _mm256_srli_epi64(lo, limb_bits)));
+                            return _mm256_and_si256(lo, mask);
+                        }
+
+                        static void mul_avx2_dispatch(data_type &r, const data_type &a, const data_type &b,
+                                                      const modulus_type &p, std::uint64_t n0, std::true_type) {
+                            mul_avx2(r, a, b, p, n0);
+                        }
+
+                        static void mul_avx2_dispatch(data_type &r, const data_type &a, const data_type &b,
+                                                      const modulus_type &p, std::uint64_t n0, std::false_type) {
+                            mul_reference(r, a, b, p, n0);
+                        }
+#endif
+
+#ifdef CRYPTO3_ALGEBRA_HAS_AVX512IFMA_KERNEL
+                        static void mul_avx512ifma_dispatch(data_type &r, const data_type &a, const data_type &b,
+                                                            const modulus_type &p, std::uint64_t n0, std::true_type) {
+                            mul_avx512ifma(r, a, b, p, n0);
+                        }
+
+                        static void mul_avx512ifma_dispatch(data_type &r, const data_type &a, const data_type &b,
+                                                            const modulus_type &p, std::uint64_t n0, std::false_type) {
+                            mul_reference(r, a, b, p, n0);
+                        }
+#endif
+
+                        static void reduce_once(data_type &r, std::size_t lane, const modulus_type &p) {
+                            std::uint64_t d[Limbs];
+                            std::uint64_t borrow = 0;
+                            for (std::size_t i = 0; i < Limbs; ++i) {
+                                std::uint64_t v = r[i][lane] - p[i] - borrow;
+                                d[i] = v & limb_mask;
+                                borrow = v >> 63;
+                            }
+                            if (!borrow) {
+                                for (std::size_t i = 0; i < Limbs; ++i) {
+                                    r[i][lane] = d[i];
+                                }
+                            }
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_MONTGOMERY_LANES_HPP
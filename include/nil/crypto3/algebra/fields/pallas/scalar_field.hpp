@@ -49,11 +49,16 @@ namespace nil {
                     typedef typename policy_type::extended_integral_type extended_integral_type;
 
                     constexpr static const std::size_t number_bits = policy_type::number_bits;
-                    typedef typename policy_type::modular_type modular_type;
 
                     constexpr static const integral_type modulus =
                         0x40000000000000000000000000000000224698fc0994a8dd8c46eb2100000001_cppui255;
 
+                    typedef typename policy_type::modular_backend modular_backend;
+                    constexpr static const modular_params_type modulus_params = modulus;
+                    typedef nil::crypto3::multiprecision::number<
+                        nil::crypto3::multiprecision::backends::modular_adaptor<modular_backend, nil::crypto3::multiprecision::backends::modular_params_ct<modular_backend, modulus_params>>>
+                        modular_type;
+
                     typedef typename detail::element_fp<params<pallas_scalar_field>> value_type;
 
                     constexpr static const std::size_t value_bits = modulus_bits;
@@ -27,6 +27,9 @@
 #ifndef CRYPTO3_ALGEBRA_MARSHALLING_HPP
 #define CRYPTO3_ALGEBRA_MARSHALLING_HPP
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include <tuple>
 
@@ -293,6 +296,254 @@ namespace nil {
             };
         }    // namespace bincode
 
+        /*
+         * Native marshalling dumps the limbs of Montgomery-form field elements exactly as they are held in
+         * memory, so loading needs neither byte-wise import nor a conversion back into Montgomery form. The
+         * layout depends on the host (limb size, byte order) and on the library version, which is why every
+         * buffer starts with a header that is checked on import. The header also carries the low 64 bits of
+         * the base field modulus, so that a buffer of one field is not loaded as another field of the same
+         * size. Use it for trusted caches only: imported elements are not validated.
+         */
+        namespace native {
+            constexpr static const std::uint32_t format_magic = 0x4e334332;    // "2C3N" on little-endian hosts
+            constexpr static const std::uint16_t format_version = 1;
+
+            struct header {
+                std::uint32_t magic;
+                std::uint16_t version;
+                std::uint16_t limb_size;
+                std::uint32_t modulus_bits;
+                std::uint32_t element_size;
+                std::uint64_t modulus_fingerprint;
+                std::uint64_t count;
+            };
+
+            namespace detail {
+                template<typename FieldType, bool = algebra::is_extended_field<FieldType>::value>
+                struct base_field {
+                    typedef FieldType type;
+                };
+
+                template<typename FieldType>
+                struct base_field<FieldType, true> {
+                    typedef typename base_field<typename FieldType::underlying_field_type>::type type;
+                };
+
+                template<typename Codec, typename InputIterator>
+                std::uint8_t *export_range(InputIterator first, InputIterator last, std::uint8_t *out) {
+                    header h = {format_magic,
+                                format_version,
+                                Codec::limb_size,
+                                Codec::modulus_bits,
+                                Codec::element_size,
+                                Codec::modulus_fingerprint(),
+                                static_cast<std::uint64_t>(std::distance(first, last))};
+                    std::memcpy(out, &h, sizeof(header));
+                    out += sizeof(header);
+                    for (; first != last; ++first) {
+                        out = Codec::write(*first, out);
+                    }
+                    return out;
+                }
+
+                template<typename Codec>
+                bool check_header(const std::uint8_t *first, const std::uint8_t *last, header &h) {
+                    if (std::size_t(last - first) < sizeof(header)) {
+                        return false;
+                    }
+                    std::memcpy(&h, first, sizeof(header));
+                    return h.magic == format_magic && h.version == format_version && h.limb_size == Codec::limb_size &&
+                           h.modulus_bits == Codec::modulus_bits && h.element_size == Codec::element_size &&
+                           h.modulus_fingerprint == Codec::modulus_fingerprint() &&
+                           h.count == (std::size_t(last - first) - sizeof(header)) / Codec::element_size &&
+                           (std::size_t(last - first) - sizeof(header)) % Codec::element_size == 0;
+                }
+
+                template<typename Codec, typename OutputIterator>
+                bool import_range(const std::uint8_t *first, const std::uint8_t *last, OutputIterator out) {
+                    header h;
+                    if (!check_header<Codec>(first, last, h)) {
+                        return false;
+                    }
+                    first += sizeof(header);
+                    for (std::uint64_t i = 0; i < h.count; ++i) {
+                        typename Codec::value_type element;
+                        first = Codec::read(first, element);
+                        *out++ = element;
+                    }
+                    return true;
+                }
+            }    // namespace detail
+
+            template<typename FieldType>
+            struct field {
+                typedef FieldType field_type;
+                typedef typename field_type::value_type value_type;
+                typedef typename detail::base_field<field_type>::type base_field_type;
+                typedef typename base_field_type::value_type base_value_type;
+
+                typedef typename std::remove_const<typename std::remove_pointer<decltype(
+                    std::declval<const base_value_type &>().data.backend().base_data().limbs())>::type>::type
+                    limb_type;
+
+                constexpr static const std::size_t limb_size = sizeof(limb_type);
+                constexpr static const std::size_t limb_bits = 8 * limb_size;
+                constexpr static const std::size_t modulus_bits = field_type::modulus_bits;
+                constexpr static const std::size_t limbs_num = (modulus_bits + limb_bits - 1) / limb_bits;
+                constexpr static const std::size_t element_size = field_type::arity * limbs_num * limb_size;
+
+                /// The low 64 bits of the base field modulus
+                static inline std::uint64_t modulus_fingerprint() {
+                    typedef typename base_field_type::integral_type integral_type;
+                    return (integral_type(base_field_type::modulus) & integral_type(~std::uint64_t(0)))
+                        .template convert_to<std::uint64_t>();
+                }
+
+                template<typename F = field_type>
+                static inline typename std::enable_if<!algebra::is_extended_field<F>::value, std::uint8_t *>::type
+                    write(const value_type &element, std::uint8_t *out) {
+                    const auto &base = element.data.backend().base_data();
+                    std::memset(out, 0, limbs_num * limb_size);
+                    std::memcpy(out, base.limbs(), std::min<std::size_t>(base.size(), limbs_num) * limb_size);
+                    return out + limbs_num * limb_size;
+                }
+
+                template<typename F = field_type>
+                static inline typename std::enable_if<algebra::is_extended_field<F>::value, std::uint8_t *>::type
+                    write(const value_type &element, std::uint8_t *out) {
+                    for (const auto &coordinate : element.data) {
+                        out = field<typename F::underlying_field_type>::write(coordinate, out);
+                    }
+                    return out;
+                }
+
+                template<typename F = field_type>
+                static inline typename std::enable_if<!algebra::is_extended_field<F>::value, const std::uint8_t *>::type
+                    read(const std::uint8_t *in, value_type &element) {
+                    element = value_type();
+                    auto &base = element.data.backend().base_data();
+                    base.resize(limbs_num, limbs_num);
+                    std::memcpy(base.limbs(), in, limbs_num * limb_size);
+                    base.normalize();
+                    return in + limbs_num * limb_size;
+                }
+
+                template<typename F = field_type>
+                static inline typename std::enable_if<algebra::is_extended_field<F>::value, const std::uint8_t *>::type
+                    read(const std::uint8_t *in, value_type &element) {
+                    for (auto &coordinate : element.data) {
+                        in = field<typename F::underlying_field_type>::read(in, coordinate);
+                    }
+                    return in;
+                }
+
+                constexpr static inline std::size_t buffer_size(std::size_t count) {
+                    return sizeof(header) + count * element_size;
+                }
+
+                /// Writes the header and the elements of [first, last), returns the end of the written data
+                template<typename InputIterator>
+                static inline std::uint8_t *export_elements(InputIterator first, InputIterator last,
+                                                            std::uint8_t *out) {
+                    return detail::export_range<field>(first, last, out);
+                }
+
+                /// Reads the elements of a buffer written by export_elements, false if the layout does not match
+                template<typename OutputIterator>
+                static inline bool import_elements(const std::uint8_t *first, const std::uint8_t *last,
+                                                   OutputIterator out) {
+                    return detail::import_range<field>(first, last, out);
+                }
+            };
+
+            template<typename FieldType>
+            constexpr std::size_t const field<FieldType>::limb_size;
+            template<typename FieldType>
+            constexpr std::size_t const field<FieldType>::limb_bits;
+            template<typename FieldType>
+            constexpr std::size_t const field<FieldType>::modulus_bits;
+            template<typename FieldType>
+            constexpr std::size_t const field<FieldType>::limbs_num;
+            template<typename FieldType>
+            constexpr std::size_t const field<FieldType>::element_size;
+
+            template<typename GroupType>
+            struct curve_element {
+                typedef GroupType group_type;
+                typedef typename group_type::value_type value_type;
+                typedef field<typename group_type::field_type> field_codec;
+
+                constexpr static const std::size_t coordinates_num =
+                    std::is_same<typename value_type::coordinates, algebra::curves::coordinates::affine>::value ? 2 :
+                                                                                                                  3;
+
+                constexpr static const std::size_t limb_size = field_codec::limb_size;
+                constexpr static const std::size_t modulus_bits = field_codec::modulus_bits;
+                constexpr static const std::size_t element_size = coordinates_num * field_codec::element_size;
+
+                static inline std::uint64_t modulus_fingerprint() {
+                    return field_codec::modulus_fingerprint();
+                }
+
+                template<typename ValueType = value_type>
+                static inline typename std::enable_if<
+                    std::is_same<typename ValueType::coordinates, algebra::curves::coordinates::affine>::value,
+                    std::uint8_t *>::type
+                    write(const ValueType &point, std::uint8_t *out) {
+                    return field_codec::write(point.Y, field_codec::write(point.X, out));
+                }
+
+                template<typename ValueType = value_type>
+                static inline typename std::enable_if<
+                    !std::is_same<typename ValueType::coordinates, algebra::curves::coordinates::affine>::value,
+                    std::uint8_t *>::type
+                    write(const ValueType &point, std::uint8_t *out) {
+                    return field_codec::write(point.Z, field_codec::write(point.Y, field_codec::write(point.X, out)));
+                }
+
+                template<typename ValueType = value_type>
+                static inline typename std::enable_if<
+                    std::is_same<typename ValueType::coordinates, algebra::curves::coordinates::affine>::value,
+                    const std::uint8_t *>::type
+                    read(const std::uint8_t *in, ValueType &point) {
+                    return field_codec::read(field_codec::read(in, point.X), point.Y);
+                }
+
+                template<typename ValueType = value_type>
+                static inline typename std::enable_if<
+                    !std::is_same<typename ValueType::coordinates, algebra::curves::coordinates::affine>::value,
+                    const std::uint8_t *>::type
+                    read(const std::uint8_t *in, ValueType &point) {
+                    return field_codec::read(field_codec::read(field_codec::read(in, point.X), point.Y), point.Z);
+                }
+
+                constexpr static inline std::size_t buffer_size(std::size_t count) {
+                    return sizeof(header) + count * element_size;
+                }
+
+                template<typename InputIterator>
+                static inline std::uint8_t *export_elements(InputIterator first, InputIterator last,
+                                                            std::uint8_t *out) {
+                    return detail::export_range<curve_element>(first, last, out);
+                }
+
+                template<typename OutputIterator>
+                static inline bool import_elements(const std::uint8_t *first, const std::uint8_t *last,
+                                                   OutputIterator out) {
+                    return detail::import_range<curve_element>(first, last, out);
+                }
+            };
+
+            template<typename GroupType>
+            constexpr std::size_t const curve_element<GroupType>::coordinates_num;
+            template<typename GroupType>
+            constexpr std::size_t const curve_element<GroupType>::limb_size;
+            template<typename GroupType>
+            constexpr std::size_t const curve_element<GroupType>::modulus_bits;
+            template<typename GroupType>
+            constexpr std::size_t const curve_element<GroupType>::element_size;
+        }    // namespace native
+
     }    // namespace marshalling
 }    // namespace nil
 
@@ -0,0 +1,208 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Pavel Kharitonov <ipavrus@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_DOUBLE_SCALAR_MUL_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_DOUBLE_SCALAR_MUL_HPP
+
+#include <array>
+#include <iterator>
+#include <vector>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/wnaf.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/curves/detail/glv.hpp>
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /**
+                 * Windows of the wNAF recodings: the table of the generator is built once, so it can afford to be
+                 * much wider than the one built for the other point on every call.
+                 */
+                constexpr const std::size_t double_scalar_mul_generator_window = 8;
+                constexpr const std::size_t double_scalar_mul_window = 5;
+
+                template<typename Backend, multiprecision::expression_template_option ExpressionTemplates>
+                std::vector<long> signed_wnaf(const std::size_t window_size,
+                                              const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                    if (scalar.sign() >= 0) {
+                        return multiprecision::find_wnaf(window_size, scalar);
+                    }
+
+                    const multiprecision::number<Backend, ExpressionTemplates> magnitude = -scalar;
+                    std::vector<long> naf = multiprecision::find_wnaf(window_size, magnitude);
+                    for (long &digit : naf) {
+                        digit = -digit;
+                    }
+                    return naf;
+                }
+
+                /**
+                 * u1 * G + u2 * Q as one interleaved wNAF multiplication.
+                 */
+                template<typename GroupType,
+                         bool HasEndomorphism =
+                             curves::detail::glv_endomorphism_policy<typename GroupType::params_type>::value>
+                struct double_scalar_mul_policy {
+                    typedef typename GroupType::value_type value_type;
+                    typedef wnaf_table<value_type> table_type;
+
+                    static const table_type &generator_table() {
+                        static const table_type table(double_scalar_mul_generator_window, value_type::one());
+                        return table;
+                    }
+
+                    template<typename Backend, multiprecision::expression_template_option ExpressionTemplates>
+                    static value_type process(const multiprecision::number<Backend, ExpressionTemplates> &u1,
+                                              const value_type &Q,
+                                              const multiprecision::number<Backend, ExpressionTemplates> &u2) {
+                        const table_type table(double_scalar_mul_window, Q);
+
+                        return interleaved_wnaf_exp<value_type>(
+                            {&generator_table(), &table},
+                            {multiprecision::find_wnaf(double_scalar_mul_generator_window, u1),
+                             multiprecision::find_wnaf(double_scalar_mul_window, u2)});
+                    }
+                };
+
+                /**
+                 * With an endomorphism both scalars are split in halves, so the four terms k1 * G + k2 * phi(G) +
+                 * l1 * Q + l2 * phi(Q) share a chain of half as many doublings.
+                 */
+                template<typename GroupType>
+                struct double_scalar_mul_policy<GroupType, true> {
+                    typedef typename GroupType::value_type value_type;
+                    typedef wnaf_table<value_type> table_type;
+                    typedef curves::detail::glv_endomorphism_policy<typename GroupType::params_type> endomorphism_type;
+
+                    static const std::array<table_type, 2> &generator_tables() {
+                        static const std::array<table_type, 2> tables = {
+                            {table_type(double_scalar_mul_generator_window, value_type::one()),
+                             table_type(double_scalar_mul_generator_window,
+                                        endomorphism_type::phi(value_type::one()))}};
+                        return tables;
+                    }
+
+                    template<typename Backend, multiprecision::expression_template_option ExpressionTemplates>
+                    static value_type process(const multiprecision::number<Backend, ExpressionTemplates> &u1,
+                                              const value_type &Q,
+                                              const multiprecision::number<Backend, ExpressionTemplates> &u2) {
+                        const std::array<multiprecision::cpp_int, 2> k =
+                            endomorphism_type::decompose(multiprecision::cpp_int(u1));
+                        const std::array<multiprecision::cpp_int, 2> l =
+                            endomorphism_type::decompose(multiprecision::cpp_int(u2));
+                        const table_type table(double_scalar_mul_window, Q);
+                        const table_type phi_table(double_scalar_mul_window, endomorphism_type::phi(Q));
+
+                        return interleaved_wnaf_exp<value_type>(
+                            {&generator_tables()[0], &generator_tables()[1], &table, &phi_table},
+                            {signed_wnaf(double_scalar_mul_generator_window, k[0]),
+                             signed_wnaf(double_scalar_mul_generator_window, k[1]),
+                             signed_wnaf(double_scalar_mul_window, l[0]),
+                             signed_wnaf(double_scalar_mul_window, l[1])});
+                    }
+                };
+            }    // namespace detail
+
+            /**
+             * @brief u1 * G + u2 * Q for the generator G of GroupType, the combination checked by ECDSA and Schnorr
+             * signature verification. Scalars are expected to be reduced modulo the order of G.
+             *
+             * The sum is computed by interleaved wNAF multiplication over a precomputed table for G and, on groups
+             * with a GLV endomorphism such as secp256k1, over half-length scalars. The running time depends on the
+             * scalars, which are public in signature verification.
+             */
+            template<typename GroupType, typename Backend,
+                     multiprecision::expression_template_option ExpressionTemplates>
+            typename GroupType::value_type
+                double_scalar_mul(const multiprecision::number<Backend, ExpressionTemplates> &u1,
+                                  const typename GroupType::value_type &Q,
+                                  const multiprecision::number<Backend, ExpressionTemplates> &u2) {
+                return detail::double_scalar_mul_policy<GroupType>::process(u1, Q, u2);
+            }
+
+            template<typename GroupType, typename FieldValueType>
+            typename std::enable_if<is_field<typename FieldValueType::field_type>::value &&
+                                        !is_extended_field<typename FieldValueType::field_type>::value,
+                                    typename GroupType::value_type>::type
+                double_scalar_mul(const FieldValueType &u1, const typename GroupType::value_type &Q,
+                                  const FieldValueType &u2) {
+                typedef typename FieldValueType::integral_type integral_type;
+                return double_scalar_mul<GroupType>(u1.data.template convert_to<integral_type>(), Q,
+                                                    u2.data.template convert_to<integral_type>());
+            }
+
+            /**
+             * @brief Checks u1_i * G + u2_i * Q_i == R_i for all i with a single multiexponentiation.
+             *
+             * The equations are combined with random weights z_i into
+             * (sum z_i * u1_i) * G + sum (z_i * u2_i) * Q_i - sum z_i * R_i == 0, which holds whenever all of
+             * them do and otherwise fails but with probability about 1 / r. A failed check does not tell which
+             * equation is wrong; the caller has to fall back to double_scalar_mul for each of them.
+             */
+            template<typename GroupType, typename MultiexpMethod = policies::multiexp_method_BDLO12,
+                     typename InputScalarIterator, typename InputBaseIterator>
+            bool batch_double_scalar_mul_check(InputScalarIterator u1_first, InputScalarIterator u1_last,
+                                               InputBaseIterator Q_first, InputScalarIterator u2_first,
+                                               InputBaseIterator R_first) {
+                typedef typename GroupType::value_type value_type;
+                typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+                typedef typename scalar_field_type::value_type scalar_value_type;
+
+                const std::size_t length = std::distance(u1_first, u1_last);
+
+                std::vector<value_type> bases;
+                std::vector<scalar_value_type> scalars;
+                bases.reserve(2 * length + 1);
+                scalars.reserve(2 * length + 1);
+
+                bases.emplace_back(value_type::one());
+                scalars.emplace_back(scalar_value_type::zero());
+                for (; u1_first != u1_last; ++u1_first, ++Q_first, ++u2_first, ++R_first) {
+                    const scalar_value_type z = random_element<scalar_field_type>();
+
+                    scalars[0] += z * *u1_first;
+                    bases.emplace_back(*Q_first);
+                    scalars.emplace_back(z * *u2_first);
+                    bases.emplace_back(*R_first);
+                    scalars.emplace_back(-z);
+                }
+
+                return multiexp<MultiexpMethod>(bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1)
+                    .is_zero();
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_DOUBLE_SCALAR_MUL_HPP
@@ -0,0 +1,271 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Pavel Kharitonov <ipavrus@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_FIXED_BASE_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_FIXED_BASE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/params.hpp>
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /**
+                 * Representation of the points stored in a fixed-base table and how they are added to the
+                 * accumulator. By default points are kept as they are and added with operator+.
+                 */
+                template<typename GroupValueType,
+                         typename Form = typename GroupValueType::form,
+                         typename Coordinates = typename GroupValueType::coordinates>
+                struct fixed_base_entry {
+                    typedef GroupValueType type;
+
+                    static type make(const GroupValueType &P) {
+                        return P;
+                    }
+
+                    static GroupValueType add(const GroupValueType &acc, const type &P) {
+                        return acc + P;
+                    }
+
+                    static GroupValueType add_complete(const GroupValueType &acc, const type &P) {
+                        return acc + P;
+                    }
+                };
+
+                /**
+                 * Projective short Weierstrass points are normalized to Z = 1 and added by mixed addition. Mixed
+                 * addition does not handle doubling, which can only be hit on the top rows of a table, where the
+                 * partial sums may exceed the group order, so those rows go through operator+.
+                 */
+                template<typename GroupValueType, typename Coordinates>
+                struct fixed_base_entry<GroupValueType, curves::forms::short_weierstrass, Coordinates> {
+                    typedef GroupValueType type;
+
+                    static type make(const GroupValueType &P) {
+                        if (P.is_zero()) {
+                            return P;
+                        }
+                        const auto A = P.to_affine();
+                        return GroupValueType(A.X, A.Y, GroupValueType::field_type::value_type::one());
+                    }
+
+                    static GroupValueType add(const GroupValueType &acc, const type &P) {
+                        return acc.mixed_add(P);
+                    }
+
+                    static GroupValueType add_complete(const GroupValueType &acc, const type &P) {
+                        return acc + P;
+                    }
+                };
+
+                template<typename GroupValueType>
+                struct fixed_base_entry<GroupValueType, curves::forms::short_weierstrass, curves::coordinates::affine>
+                    : fixed_base_entry<GroupValueType, void, void> { };
+
+                /**
+                 * Extended twisted Edwards points are normalized to Z = 1; the unified formulas need no special
+                 * handling of the top rows.
+                 */
+                template<typename GroupValueType>
+                struct fixed_base_entry<GroupValueType, curves::forms::twisted_edwards, curves::coordinates::extended> {
+                    typedef GroupValueType type;
+
+                    static type make(const GroupValueType &P) {
+                        const auto A = P.to_affine();
+                        return GroupValueType(A.X, A.Y);
+                    }
+
+                    static GroupValueType add(const GroupValueType &acc, const type &P) {
+                        return acc.mixed_add(P);
+                    }
+
+                    static GroupValueType add_complete(const GroupValueType &acc, const type &P) {
+                        return acc.mixed_add(P);
+                    }
+                };
+
+                /**
+                 * For a = -1 the points are stored as (y+x, y-x, 2*d*x*y).
+                 */
+                template<typename GroupValueType>
+                struct fixed_base_entry<GroupValueType,
+                                        curves::forms::twisted_edwards,
+                                        curves::coordinates::extended_with_a_minus_1> {
+                    typedef typename GroupValueType::precomputed_type type;
+
+                    static type make(const GroupValueType &P) {
+                        return P.to_precomputed();
+                    }
+
+                    static GroupValueType add(const GroupValueType &acc, const type &P) {
+                        return acc.mixed_add(P);
+                    }
+
+                    static GroupValueType add_complete(const GroupValueType &acc, const type &P) {
+                        return acc.mixed_add(P);
+                    }
+                };
+            }    // namespace detail
+
+            /**
+             * Table of multiples of a fixed point for fixed-base scalar multiplication.
+             *
+             * A scalar of up to scalar_bits bits is recoded into signed digits d_i in [-2^(w-1), 2^(w-1)) of
+             * w = window bits, so that k = sum(d_i * 2^(w*i)). Row i of the table holds j * 2^(w*i) * P for
+             * j = 1 .. 2^(w-1), and k * P is the sum of one (possibly negated) entry per row: no doublings are
+             * performed at multiplication time.
+             */
+            template<typename GroupType>
+            class fixed_base_table {
+            public:
+                typedef typename GroupType::value_type value_type;
+
+            private:
+                typedef detail::fixed_base_entry<value_type> entry_policy;
+                typedef typename entry_policy::type entry_type;
+
+            public:
+                fixed_base_table(const value_type &base = value_type::one(),
+                                 std::size_t scalar_bits = curves::fixed_base_params<GroupType>::scalar_bits,
+                                 std::size_t window = curves::fixed_base_params<GroupType>::window) :
+                    base(base),
+                    scalar_bits(scalar_bits), window(window), rows((scalar_bits + window - 1) / window + 1) {
+                    BOOST_ASSERT(window > 1 && window < 16);
+
+                    // partial sums of the first rows stay below 2^(order_bits - 1), so they never coincide with
+                    // the next entry or its negation
+                    mixed_rows = std::min(rows, (GroupType::curve_type::scalar_field_type::modulus_bits - 1) / window);
+
+                    const std::size_t row_size = std::size_t(1) << (window - 1);
+
+                    table.reserve(rows);
+                    value_type row_base = base;
+                    for (std::size_t i = 0; i < rows; ++i) {
+                        std::vector<entry_type> row;
+                        row.reserve(row_size);
+
+                        value_type multiple = row_base;
+                        for (std::size_t j = 0; j < row_size; ++j) {
+                            row.emplace_back(entry_policy::make(multiple));
+                            multiple += row_base;
+                        }
+                        table.emplace_back(std::move(row));
+
+                        for (std::size_t j = 0; j < window; ++j) {
+                            row_base.double_inplace();
+                        }
+                    }
+                }
+
+                /**
+                 * @return scalar * base; scalars longer than scalar_bits fall back to double-and-add
+                 */
+                template<typename Backend, multiprecision::expression_template_option ExpressionTemplates>
+                value_type mul(const multiprecision::number<Backend, ExpressionTemplates> &scalar) const {
+                    if (scalar.is_zero()) {
+                        return value_type::zero();
+                    }
+                    if (multiprecision::msb(scalar) >= scalar_bits) {
+                        return curves::detail::scalar_mul(base, scalar);
+                    }
+
+                    const std::int64_t radix = std::int64_t(1) << window;
+                    value_type result = value_type::zero();
+                    std::int64_t carry = 0;
+
+                    for (std::size_t i = 0; i < rows; ++i) {
+                        std::int64_t digit = carry;
+                        for (std::size_t j = 0; j < window; ++j) {
+                            if (multiprecision::bit_test(scalar, i * window + j)) {
+                                digit += std::int64_t(1) << j;
+                            }
+                        }
+                        carry = digit >= radix / 2 ? 1 : 0;
+                        digit -= carry * radix;
+
+                        if (digit != 0) {
+                            const entry_type &entry = table[i][(digit > 0 ? digit : -digit) - 1];
+                            result = i < mixed_rows ?
+                                         entry_policy::add(result, digit > 0 ? entry : -entry) :
+                                         entry_policy::add_complete(result, digit > 0 ? entry : -entry);
+                        }
+                    }
+                    BOOST_ASSERT(carry == 0);
+
+                    return result;
+                }
+
+                template<typename FieldValueType>
+                typename std::enable_if<is_field<typename FieldValueType::field_type>::value &&
+                                            !is_extended_field<typename FieldValueType::field_type>::value,
+                                        value_type>::type
+                    mul(const FieldValueType &scalar) const {
+                    return mul(scalar.data.template convert_to<typename FieldValueType::integral_type>());
+                }
+
+            private:
+                value_type base;
+                std::size_t scalar_bits;
+                std::size_t window;
+                std::size_t rows;
+                std::size_t mixed_rows;
+                std::vector<std::vector<entry_type>> table;
+            };
+
+            /**
+             * @return the table of the generator of GroupType, built on first use
+             */
+            template<typename GroupType>
+            const fixed_base_table<GroupType> &generator_table() {
+                static const fixed_base_table<GroupType> table;
+                return table;
+            }
+
+            /**
+             * @brief Multiplication of the generator of GroupType by scalar using its precomputed table.
+             */
+            template<typename GroupType, typename ScalarType>
+            typename GroupType::value_type fixed_base_mul(const ScalarType &scalar) {
+                return generator_table<GroupType>().mul(scalar);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_FIXED_BASE_HPP
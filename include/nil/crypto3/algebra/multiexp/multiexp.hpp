@@ -95,9 +95,9 @@ namespace nil {
                 for (; scalar_it != scalar_end; ++scalar_it, ++vec_it) {
                     if (*scalar_it == one) {
 #ifdef USE_MIXED_ADDITION
-                        acc = acc.mixed_add(*vec_it);
+                        acc.mixed_add_inplace(*vec_it);
 #else
-                        acc = acc + (*vec_it);
+                        acc += (*vec_it);
 #endif
                     } else if (*scalar_it != zero) {
                         p.emplace_back(*scalar_it);
@@ -160,11 +160,11 @@ namespace nil {
                     std::size_t cur_in_window = outer == outerc - 1 ? last_in_window : in_window;
                     for (std::size_t inner = 0; inner < cur_in_window; ++inner) {
                         powers_of_g[outer][inner] = ginner;
-                        ginner = ginner + gouter;
+                        ginner += gouter;
                     }
 
                     for (std::size_t i = 0; i < window; ++i) {
-                        gouter = gouter.doubled();
+                        gouter.double_inplace();
                     }
                 }
 
@@ -193,7 +193,7 @@ namespace nil {
                         }
                     }
 
-                    res = res + powers_of_g[outer][inner];
+                    res += powers_of_g[outer][inner];
                 }
 
                 return res;
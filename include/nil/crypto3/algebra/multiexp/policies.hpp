@@ -33,6 +33,7 @@
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/curves/detail/cached_element.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -79,7 +80,7 @@ namespace nil {
                         InputFieldIterator scalar_it;
 
                         for (vec_it = vec_start, scalar_it = scalar_start; vec_it != vec_end; ++vec_it, ++scalar_it) {
-                            result = result + (*scalar_it) * (*vec_it);
+                            result += (*scalar_it) * (*vec_it);
                         }
 
                         BOOST_ASSERT(scalar_it == scalar_end);
@@ -96,6 +97,8 @@ namespace nil {
                  * When compiled with USE_MIXED_ADDITION, assumes input is in special form.
                  * Requires that base_value_type implements .dbl() (and, if USE_MIXED_ADDITION is defined,
                  * .to_projective(), .mixed_add(), and batch_to_projective()).
+                 * Otherwise bases of element types with a cached form are converted to it once, since every
+                 * base is added to a bucket in each of the scalar windows.
                  */
                 struct multiexp_method_BDLO12 {
                     template<typename InputBaseIterator, typename InputFieldIterator>
@@ -132,13 +135,25 @@ namespace nil {
 
                         std::size_t num_groups = (num_bits + c - 1) / c;
 
+                        typedef curves::detail::cached_element<base_value_type> cached_policy;
+
+                        std::vector<typename cached_policy::type> cached_bases;
+#ifndef USE_MIXED_ADDITION
+                        if (cached_policy::value && num_groups > 1) {
+                            cached_bases.reserve(length);
+                            for (std::size_t i = 0; i < length; i++) {
+                                cached_bases.emplace_back(cached_policy::cache(bases[i]));
+                            }
+                        }
+#endif
+
                         base_value_type result;
                         bool result_nonzero = false;
 
                         for (std::size_t k = num_groups - 1; k <= num_groups; k--) {
                             if (result_nonzero) {
                                 for (std::size_t i = 0; i < c; i++) {
-                                    result = result.doubled();
+                                    result.double_inplace();
                                 }
                             }
 
@@ -159,9 +174,13 @@ namespace nil {
 
                                 if (bucket_nonzero[id]) {
 #ifdef USE_MIXED_ADDITION
-                                    buckets[id] = buckets[id].mixed_add(bases[i]);
+                                    buckets[id].mixed_add_inplace(bases[i]);
 #else
-                                    buckets[id] = buckets[id] + bases[i];
+                                    if (cached_bases.empty()) {
+                                        buckets[id] += bases[i];
+                                    } else {
+                                        buckets[id] += cached_bases[i];
+                                    }
 #endif
                                 } else {
                                     buckets[id] = bases[i];
@@ -180,9 +199,9 @@ namespace nil {
                                 if (bucket_nonzero[i]) {
                                     if (running_sum_nonzero) {
 #ifdef USE_MIXED_ADDITION
-                                        running_sum = running_sum.mixed_add(buckets[i]);
+                                        running_sum.mixed_add_inplace(buckets[i]);
 #else
-                                        running_sum = running_sum + buckets[i];
+                                        running_sum += buckets[i];
 #endif
                                     } else {
                                         running_sum = buckets[i];
@@ -192,7 +211,7 @@ namespace nil {
 
                                 if (running_sum_nonzero) {
                                     if (result_nonzero) {
-                                        result = result + running_sum;
+                                        result += running_sum;
                                     } else {
                                         result = running_sum;
                                         result_nonzero = true;
@@ -277,7 +296,7 @@ namespace nil {
 
                             if (b.r.is_zero()) {
                                 // opt_result = opt_result + (a.r * g[a.idx]);
-                                opt_result = opt_result + opt_window_wnaf_exp(g[a.idx], a.r, abits);
+                                opt_result += opt_window_wnaf_exp(g[a.idx], a.r, abits);
                                 break;
                             }
 
@@ -290,13 +309,13 @@ namespace nil {
                                   subtracting b from a multiple times, so let's do it directly
                                 */
                                 // opt_result = opt_result + (a.r * g[a.idx]);
-                                opt_result = opt_result + opt_window_wnaf_exp(g[a.idx], a.r, abits);
+                                opt_result += opt_window_wnaf_exp(g[a.idx], a.r, abits);
 
                                 a.r = 0;
                             } else {
                                 // x A + y B => (x-y) A + y (B+A)
                                 a.r = a.r - b.r;
-                                g[b.idx] = g[b.idx] + g[a.idx];
+                                g[b.idx] += g[a.idx];
                             }
 
                             // regardless of whether a was cleared or subtracted from we push it down, then take back up
@@ -28,12 +28,13 @@
 
 #include <nil/crypto3/algebra/curves/babyjubjub.hpp>
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
-#include <nil/crypto3/algebra/pairing/detail/alt_bn128/254/params.hpp>
+#include <nil/crypto3/algebra/pairing/detail/alt_bn128/params.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_double_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g1.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/final_exponentiation.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/gt_exp.hpp>
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
@@ -54,6 +55,7 @@ namespace nil {
                         pairing::short_weierstrass_jacobian_with_a4_0_ate_double_miller_loop<curve_type>;
                     using final_exponentiation =
                         pairing::short_weierstrass_jacobian_with_a4_0_final_exponentiation<curve_type>;
+                    using gt_exp = pairing::short_weierstrass_jacobian_with_a4_0_gt_exp<curve_type>;
 
                     using g1_precomputed_type = typename precompute_g1::g1_precomputed_type;
                     using g2_precomputed_type = typename precompute_g2::g2_precomputed_type;
@@ -54,11 +54,18 @@ namespace nil {
                             0x2F4B6DC97020FDDADF107D20BC842D43BF6369B1FF6A1C71015F3F7BE2E1E30A73BB94FEC0DAF15466B2383A5D3EC3D15AD524D8F70C54EFEE1BD8C3B21377E563A09A1B705887E72ECEADDEA3790364A61F676BAAF977870E88D5C6C8FEF0781361E443AE77F5B63A2A2264487F2940A8B1DDB3D15062CD0FB2015DFC6668449AED3CC48A82D0D602D268C7DAAB6A41294C0CC4EBE5664568DFC50E1648A45A4A1E3A5195846A3ED011A337A02088EC80E0EBAE8755CFE107ACF3AAFB40494E406F804216BB10CF430B0F37856B42DB8DC5514724EE93DFB10826F0DD4A0364B9580291D2CD65664814FDE37CA80BB4EA44EACC5E641BBADF423F9A2CBF813B8D145DA90029BAEE7DDADDA71C7F3811C4105262945BBA1668C3BE69A3C230974D83561841D766F9C9D570BB7FBE04C7E8A6C3C760C0DE81DEF35692DA361102B6B9B2B918837FA97896E84ABB40A4EFB7E54523A486964B64CA86F120_cppui2790);
 
                         constexpr static const integral_type final_exponent_z = integral_type(0x44E992B44A6909F1);
-                        constexpr static const integral_type final_exponent_is_z_neg = false;
+                        constexpr static const bool final_exponent_is_z_neg = false;
 
-                        using g2_field_type_value = typename curve_type::g2_type::field_type::value_type;
+                        ///< p = 6 * z^2 (mod r), a 127-bit eigenvalue, so GT exponents split into two digits
+                        constexpr static const std::size_t gt_exp_dimension = 2;
+                        constexpr static const integral_type gt_exp_frobenius_eigenvalue =
+                            0x6F4D8248EEB859FBF83E9682E87CFD46_cppui254;
+                        constexpr static const bool gt_exp_is_frobenius_eigenvalue_neg = false;
 
-                        constexpr static const g2_field_type_value twist = g2_type::params_type::twist;
+                        using g2_field_type_value = typename curve_type::template g2_type<>::field_type::value_type;
+
+                        constexpr static const g2_field_type_value twist =
+                            curve_type::template g2_type<>::params_type::twist;
                     };
 
                     constexpr typename pairing_params<curves::alt_bn128<254>>::integral_type const
@@ -72,6 +79,13 @@ namespace nil {
 
                     constexpr bool const pairing_params<curves::alt_bn128<254>>::ate_is_loop_count_neg;
                     constexpr bool const pairing_params<curves::alt_bn128<254>>::final_exponent_is_z_neg;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist;
+
+                    constexpr std::size_t const pairing_params<curves::alt_bn128<254>>::gt_exp_dimension;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::integral_type const
+                        pairing_params<curves::alt_bn128<254>>::gt_exp_frobenius_eigenvalue;
+                    constexpr bool const pairing_params<curves::alt_bn128<254>>::gt_exp_is_frobenius_eigenvalue_neg;
 
                 }    // namespace detail
             }        // namespace pairing
@@ -56,6 +56,11 @@ namespace nil {
                         constexpr static const integral_type final_exponent_z = 0xD201000000010000_cppui64;
                         constexpr static const bool final_exponent_is_z_neg = true;
 
+                        ///< p = -|z| (mod r), so GT exponents split into four base-|z| digits
+                        constexpr static const std::size_t gt_exp_dimension = 4;
+                        constexpr static const integral_type gt_exp_frobenius_eigenvalue = 0xD201000000010000_cppui64;
+                        constexpr static const bool gt_exp_is_frobenius_eigenvalue_neg = true;
+
                         using g2_field_type_value = typename curve_type::template g2_type<>::field_type::value_type;
 
                         constexpr static const g2_field_type_value twist =
@@ -77,6 +82,11 @@ namespace nil {
 
                     constexpr bool const pairing_params<curves::bls12<381>>::final_exponent_is_z_neg;
 
+                    constexpr std::size_t const pairing_params<curves::bls12<381>>::gt_exp_dimension;
+                    constexpr typename pairing_params<curves::bls12<381>>::integral_type const
+                        pairing_params<curves::bls12<381>>::gt_exp_frobenius_eigenvalue;
+                    constexpr bool const pairing_params<curves::bls12<381>>::gt_exp_is_frobenius_eigenvalue_neg;
+
                 }    // namespace detail
             }        // namespace pairing
         }            // namespace algebra
@@ -26,6 +26,8 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_FINAL_EXPONENTIATION_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_FINAL_EXPONENTIATION_HPP
 
+#include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
+
 #include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
 
 namespace nil {
@@ -43,6 +45,11 @@ namespace nil {
                     using base_field_type = typename curve_type::base_field_type;
                     using gt_type = typename curve_type::gt_type;
 
+                    // z is sparse, so a window of 1 keeps the chain free of precomputed powers
+                    typedef fields::detail::fixed_exponent_chain<base_field_type::modulus_bits, 1> z_chain_type;
+                    constexpr static const z_chain_type final_exponent_z_chain =
+                        z_chain_type(params_type::final_exponent_z);
+
                     static typename gt_type::value_type
                         final_exponentiation_first_chunk(const typename gt_type::value_type &elt) {
 
@@ -69,7 +76,7 @@ namespace nil {
 
                     static typename gt_type::value_type exp_by_z(const typename gt_type::value_type &elt) {
 
-                        typename gt_type::value_type result = elt.cyclotomic_exp(params_type::final_exponent_z);
+                        typename gt_type::value_type result = elt.cyclotomic_exp(final_exponent_z_chain);
                         if (params_type::final_exponent_is_z_neg) {
                             result = result.unitary_inversed();
                         }
@@ -126,6 +133,10 @@ namespace nil {
                         return result;
                     }
                 };
+
+                template<typename CurveType>
+                constexpr typename short_weierstrass_jacobian_with_a4_0_final_exponentiation<CurveType>::z_chain_type const
+                    short_weierstrass_jacobian_with_a4_0_final_exponentiation<CurveType>::final_exponent_z_chain;
             }    // namespace pairing
         }        // namespace algebra
     }            // namespace crypto3
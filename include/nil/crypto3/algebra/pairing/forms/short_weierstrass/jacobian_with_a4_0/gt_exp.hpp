@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_GT_EXP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_GT_EXP_HPP
+
+#include <array>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /*!
+                 * @brief Exponentiation in GT with a Frobenius decomposition of the exponent.
+                 *
+                 * On GT the p-power Frobenius acts as exponentiation by its eigenvalue lambda = p (mod r),
+                 * given by the pairing params as |lambda| and its sign. Writing the exponent in base |lambda| as
+                 * e = e0 + e1|lambda| + ... gives elt^e = prod (elt^(p^i))^(e_i * sign(lambda)^i), a simultaneous
+                 * exponentiation with gt_exp_dimension short exponents. For BLS12 (lambda = z, four 64-bit
+                 * digits) this is a quarter of the cyclotomic squarings; for BN254 (lambda = 6z^2, two 127-bit
+                 * digits) it is a half, since the 4-dimensional GLS lattice basis is not used there.
+                 * The input must lie in the cyclotomic subgroup, i.e. be a reduced pairing value.
+                 */
+                template<typename CurveType>
+                class short_weierstrass_jacobian_with_a4_0_gt_exp {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+
+                    using scalar_field_type = typename curve_type::scalar_field_type;
+                    using gt_type = typename curve_type::gt_type;
+
+                    using integral_type = typename scalar_field_type::integral_type;
+                    using gt_value_type = typename gt_type::value_type;
+
+                    constexpr static const std::size_t dimension = params_type::gt_exp_dimension;
+
+                public:
+                    static gt_value_type process(const gt_value_type &elt, const integral_type &exponent) {
+
+                        const integral_type lambda = integral_type(params_type::gt_exp_frobenius_eigenvalue);
+
+                        std::array<integral_type, dimension> digits;
+                        integral_type e = exponent % scalar_field_type::modulus;
+                        for (std::size_t i = 0; i < dimension - 1; ++i) {
+                            digits[i] = e % lambda;
+                            e /= lambda;
+                        }
+                        digits[dimension - 1] = e;
+
+                        // elt^(p^i), conjugated for odd i when lambda < 0
+                        std::array<gt_value_type, dimension> bases;
+                        for (std::size_t i = 0; i < dimension; ++i) {
+                            bases[i] = elt.Frobenius_map(i);
+                            if (params_type::gt_exp_is_frobenius_eigenvalue_neg && (i & 1)) {
+                                bases[i] = bases[i].unitary_inversed();
+                            }
+                        }
+
+                        // table[m] is the product of the bases selected by the bits of m
+                        std::array<gt_value_type, 1 << dimension> table;
+                        table[0] = gt_value_type::one();
+                        for (std::size_t m = 1; m < table.size(); ++m) {
+                            std::size_t low = 0;
+                            while (!((m >> low) & 1)) {
+                                ++low;
+                            }
+                            table[m] = (m == (std::size_t(1) << low)) ? bases[low] :
+                                                                         table[m ^ (std::size_t(1) << low)] * bases[low];
+                        }
+
+                        long top = -1;
+                        for (std::size_t i = 0; i < dimension; ++i) {
+                            if (digits[i] != 0) {
+                                long bits = static_cast<long>(nil::crypto3::multiprecision::msb(digits[i]));
+                                top = bits > top ? bits : top;
+                            }
+                        }
+
+                        gt_value_type result = gt_value_type::one();
+                        bool found_nonzero = false;
+                        for (long j = top; j >= 0; --j) {
+                            if (found_nonzero) {
+                                result = result.cyclotomic_squared();
+                            }
+
+                            std::size_t m = 0;
+                            for (std::size_t i = 0; i < dimension; ++i) {
+                                if (nil::crypto3::multiprecision::bit_test(digits[i], j)) {
+                                    m |= std::size_t(1) << i;
+                                }
+                            }
+
+                            if (m != 0) {
+                                result = found_nonzero ? result * table[m] : table[m];
+                                found_nonzero = true;
+                            }
+                        }
+
+                        return result;
+                    }
+
+                    static gt_value_type process(const gt_value_type &elt,
+                                                 const typename scalar_field_type::value_type &exponent) {
+                        return process(elt, exponent.data.template convert_to<integral_type>());
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_GT_EXP_HPP
@@ -55,6 +55,7 @@ namespace nil {
             BOOST_TTI_HAS_TYPE(gt_type)
 
             BOOST_TTI_HAS_TYPE(group_type)
+            BOOST_TTI_HAS_TYPE(cached_type)
 
             BOOST_TTI_HAS_STATIC_MEMBER_DATA(value_bits)
             BOOST_TTI_HAS_STATIC_MEMBER_DATA(modulus_bits)
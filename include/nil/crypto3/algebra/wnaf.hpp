@@ -25,39 +25,109 @@
 #ifndef CRYPTO3_ALGEBRA_WNAF_HPP
 #define CRYPTO3_ALGEBRA_WNAF_HPP
 
+#include <algorithm>
+#include <vector>
+
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/multiprecision/wnaf.hpp>
 
 #include <nil/crypto3/algebra/curves/params.hpp>
+#include <nil/crypto3/algebra/curves/detail/cached_element.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
+            /**
+             * Odd multiples base, 3 * base, .., (2^w - 1) * base, stored in cached form where the element type has
+             * one, to which the nonzero digits of a width-w NAF of a scalar refer.
+             */
+            template<typename BaseValueType>
+            class wnaf_table {
+                typedef curves::detail::cached_element<BaseValueType> cached_policy;
+
+            public:
+                typedef BaseValueType value_type;
+
+                wnaf_table(const std::size_t window_size, const BaseValueType &base) : window(window_size) {
+                    table.reserve(1ul << (window_size - 1));
+                    BaseValueType tmp = base;
+                    BaseValueType dbl = base.doubled();
+                    for (size_t i = 0; i < 1ul << (window_size - 1); ++i) {
+                        table.emplace_back(cached_policy::cache(tmp));
+                        tmp += dbl;
+                    }
+                }
+
+                std::size_t window_size() const {
+                    return window;
+                }
+
+                /**
+                 * @brief acc += digit * base for an odd wNAF digit
+                 */
+                void add(BaseValueType &acc, const long digit) const {
+                    if (digit > 0) {
+                        acc += table[digit / 2];
+                    } else {
+                        acc -= table[(-digit) / 2];
+                    }
+                }
+
+            private:
+                std::size_t window;
+                std::vector<typename cached_policy::type> table;
+            };
+
             template<typename BaseValueType, typename Backend,
                      multiprecision::expression_template_option ExpressionTemplates>
             BaseValueType fixed_window_wnaf_exp(const std::size_t window_size, const BaseValueType &base,
                                                 const multiprecision::number<Backend, ExpressionTemplates> &scalar) {
                 std::vector<long> naf = multiprecision::find_wnaf(window_size, scalar);
-                std::vector<BaseValueType> table(1ul << (window_size - 1));
-                BaseValueType tmp = base;
-                BaseValueType dbl = base.doubled();
-                for (size_t i = 0; i < 1ul << (window_size - 1); ++i) {
-                    table[i] = tmp;
-                    tmp = tmp + dbl;
-                }
+                wnaf_table<BaseValueType> table(window_size, base);
 
                 BaseValueType res = BaseValueType::zero();
                 bool found_nonzero = false;
                 for (long i = naf.size() - 1; i >= 0; --i) {
                     if (found_nonzero) {
-                        res = res.doubled();
+                        res.double_inplace();
                     }
 
                     if (naf[i] != 0) {
                         found_nonzero = true;
-                        if (naf[i] > 0) {
-                            res = res + table[naf[i] / 2];
-                        } else {
-                            res = res - table[(-naf[i]) / 2];
+                        table.add(res, naf[i]);
+                    }
+                }
+
+                return res;
+            }
+
+            /**
+             * @brief sum(k_j * P_j) given the table of every P_j and the wNAF digits of every k_j (Straus-Shamir
+             * trick): all terms share a single chain of doublings, so adding a term costs only its additions.
+             * Digits may be negated to subtract a term; the recodings need not have the same length or window.
+             */
+            template<typename BaseValueType>
+            BaseValueType interleaved_wnaf_exp(const std::vector<const wnaf_table<BaseValueType> *> &tables,
+                                               const std::vector<std::vector<long>> &nafs) {
+                BOOST_ASSERT(tables.size() == nafs.size());
+
+                std::size_t length = 0;
+                for (const std::vector<long> &naf : nafs) {
+                    length = std::max(length, naf.size());
+                }
+
+                BaseValueType res = BaseValueType::zero();
+                bool found_nonzero = false;
+                for (long i = length - 1; i >= 0; --i) {
+                    if (found_nonzero) {
+                        res.double_inplace();
+                    }
+
+                    for (std::size_t j = 0; j < nafs.size(); ++j) {
+                        if (std::size_t(i) < nafs[j].size() && nafs[j][i] != 0) {
+                            found_nonzero = true;
+                            tables[j]->add(res, nafs[j][i]);
                         }
                     }
                 }
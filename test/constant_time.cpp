@@ -0,0 +1,188 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE constant_time_algebra_test
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/constant_time_scalar_mul.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/jubjub.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename GroupType>
+void check_constant_time_scalar_mul() {
+    using group_value_type = typename GroupType::value_type;
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using integral_type = typename scalar_field_type::integral_type;
+
+    group_value_type P = random_element<GroupType>();
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        integral_type k = random_element<scalar_field_type>().data.template convert_to<integral_type>();
+        BOOST_CHECK(curves::detail::scalar_mul(P, k, curves::detail::constant_time<>()) == P * k);
+        BOOST_CHECK(curves::detail::scalar_mul(P, k, curves::detail::constant_time<2>()) == P * k);
+        BOOST_CHECK(curves::detail::scalar_mul(P, k, curves::detail::variable_time()) == P * k);
+    }
+
+    BOOST_CHECK(curves::detail::scalar_mul(P, integral_type(0), curves::detail::constant_time<>()).is_zero());
+    BOOST_CHECK(curves::detail::scalar_mul(P, integral_type(1), curves::detail::constant_time<>()) == P);
+    BOOST_CHECK(curves::detail::scalar_mul(P, integral_type(2), curves::detail::constant_time<>()) == P.doubled());
+    BOOST_CHECK(curves::detail::scalar_mul(P, integral_type(scalar_field_type::modulus - 1),
+                                           curves::detail::constant_time<>()) == -P);
+    BOOST_CHECK(curves::detail::scalar_mul(P, -scalar_field_type::value_type::one(),
+                                           curves::detail::constant_time<>()) == -P);
+}
+
+/**
+ * Leakage detection in the manner of dudect (Reparaz, Balasch and Verbauwhede, "Dude, is my code constant
+ * time?"): multiplications by one fixed scalar and by fresh random scalars are timed in random order, the slower
+ * half of each class is cropped and the two classes are compared with Welch's t-test. The fixed scalar
+ * 2^(n-1) + 1 has full length and two set bits, the cheapest input of double-and-add, so a scalar-dependent
+ * implementation is told apart from a constant-time one.
+ *
+ * @return the t statistic; |t| above 10 is strong evidence that timing depends on the scalar
+ */
+template<typename GroupType, typename Policy>
+double scalar_mul_timing_t(std::size_t measurements, std::mt19937 &gen) {
+    using group_value_type = typename GroupType::value_type;
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using integral_type = typename scalar_field_type::integral_type;
+
+    std::bernoulli_distribution coin;
+
+    const group_value_type P = random_element<GroupType>();
+    const integral_type fixed = (integral_type(1) << (scalar_field_type::modulus_bits - 1)) + 1;
+
+    std::vector<double> timings[2];
+    group_value_type sink;
+    for (std::size_t i = 0; i < measurements; ++i) {
+        const bool random_class = coin(gen);
+        const integral_type k =
+            random_class ? random_element<scalar_field_type>().data.template convert_to<integral_type>() : fixed;
+
+        const auto start = std::chrono::steady_clock::now();
+        sink = curves::detail::scalar_mul(P, k, Policy());
+        const auto stop = std::chrono::steady_clock::now();
+
+        timings[random_class].push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+    BOOST_CHECK(!sink.is_zero());
+
+    double mean[2], variance[2], count[2];
+    for (std::size_t c = 0; c < 2; ++c) {
+        // the fastest half of each class, which a busy machine leaves mostly undisturbed
+        std::nth_element(timings[c].begin(), timings[c].begin() + timings[c].size() / 2, timings[c].end());
+        timings[c].resize(timings[c].size() / 2);
+
+        count[c] = timings[c].size();
+        mean[c] = 0;
+        for (double t : timings[c]) {
+            mean[c] += t / count[c];
+        }
+        variance[c] = 0;
+        for (double t : timings[c]) {
+            variance[c] += (t - mean[c]) * (t - mean[c]) / (count[c] - 1);
+        }
+    }
+
+    return (mean[0] - mean[1]) / std::sqrt(variance[0] / count[0] + variance[1] / count[1]);
+}
+
+/**
+ * Median of |t| over independent runs of scalar_mul_timing_t: a burst of noise from the rest of the machine can
+ * push a single run over the threshold, but not most of them.
+ */
+template<typename GroupType, typename Policy>
+double median_scalar_mul_timing_t(std::size_t runs, std::size_t measurements) {
+    std::mt19937 gen(0x5eed);
+
+    std::vector<double> t;
+    for (std::size_t i = 0; i < runs; ++i) {
+        t.push_back(std::abs(scalar_mul_timing_t<GroupType, Policy>(measurements, gen)));
+    }
+    std::nth_element(t.begin(), t.begin() + runs / 2, t.end());
+    return t[runs / 2];
+}
+
+/**
+ * The timing test needs a quiet machine and takes a while, so it only runs when CRYPTO3_ALGEBRA_TIMING_TESTS is set
+ * in the environment, e.g. through the "timing" ctest label enabled by BUILD_TIMING_TESTS.
+ */
+boost::test_tools::assertion_result timing_tests_enabled(boost::unit_test::test_unit_id) {
+    boost::test_tools::assertion_result result(std::getenv("CRYPTO3_ALGEBRA_TIMING_TESTS") != nullptr);
+    result.message() << "CRYPTO3_ALGEBRA_TIMING_TESTS is not set";
+    return result;
+}
+
+BOOST_AUTO_TEST_SUITE(constant_time_test_suite)
+
+BOOST_AUTO_TEST_CASE(constant_time_scalar_mul_test) {
+    check_constant_time_scalar_mul<curves::secp_k1<256>::g1_type<curves::coordinates::projective_with_a4_0>>();
+    check_constant_time_scalar_mul<curves::secp_r1<256>::g1_type<>>();
+    check_constant_time_scalar_mul<curves::curve25519::g1_type<>>();
+    check_constant_time_scalar_mul<curves::jubjub::g1_type<>>();
+    check_constant_time_scalar_mul<curves::bls12<381>::g1_type<curves::coordinates::projective_with_a4_0>>();
+    check_constant_time_scalar_mul<curves::bls12<381>::g2_type<curves::coordinates::projective_with_a4_0>>();
+}
+
+BOOST_AUTO_TEST_CASE(constant_time_scalar_mul_timing_test,
+                     *boost::unit_test::precondition(timing_tests_enabled)) {
+    using secp256k1_type = curves::secp_k1<256>::g1_type<curves::coordinates::projective_with_a4_0>;
+    using ed25519_type = curves::curve25519::g1_type<>;
+
+    constexpr std::size_t runs = 5, measurements = 4000;
+    constexpr double threshold = 10;
+
+    const double t_secp256k1 =
+        median_scalar_mul_timing_t<secp256k1_type, curves::detail::constant_time<>>(runs, measurements);
+    const double t_ed25519 =
+        median_scalar_mul_timing_t<ed25519_type, curves::detail::constant_time<>>(runs, measurements);
+    BOOST_TEST_MESSAGE("constant time: |t| = " << t_secp256k1 << " (secp256k1), " << t_ed25519 << " (ed25519)");
+    BOOST_CHECK_LT(t_secp256k1, threshold);
+    BOOST_CHECK_LT(t_ed25519, threshold);
+
+    // double-and-add has to fail, or the harness could not detect a leak at all
+    const double t_variable =
+        median_scalar_mul_timing_t<secp256k1_type, curves::detail::variable_time>(runs, measurements);
+    BOOST_TEST_MESSAGE("variable time: |t| = " << t_variable << " (secp256k1)");
+    BOOST_CHECK_GT(t_variable, threshold);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
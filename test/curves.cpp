@@ -61,8 +61,15 @@
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
 #include <nil/crypto3/algebra/fields/fp3.hpp>
+#include <nil/crypto3/algebra/fields/field.hpp>
+#include <nil/crypto3/algebra/fields/params.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/element_g1_affine.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/hessian/projective/element_g1.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/algorithms/batch_affine.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
@@ -108,7 +115,8 @@ typename std::enable_if<std::is_same<Coordinates, curves::coordinates::projectiv
 }
 
 template<typename CurveParams, typename Form, typename Coordinates>
-typename std::enable_if<std::is_same<Coordinates, curves::coordinates::extended_with_a_minus_1>::value>::type
+typename std::enable_if<std::is_same<Coordinates, curves::coordinates::extended_with_a_minus_1>::value ||
+                        std::is_same<Coordinates, curves::coordinates::extended>::value>::type
     print_curve_point(std::ostream &os, const curves::detail::curve_element<CurveParams, Form, Coordinates> &p) {
     os << "( X: [";
     print_field_element(os, p.X);
@@ -421,6 +429,137 @@ void curve_operation_test_montgomery(const TestSet &test_set,
     check_montgomery_twisted_edwards_conversion(points, constants);
 }
 
+template<typename CurveGroup>
+void check_subgroup_membership() {
+    using group_value_type = typename CurveGroup::value_type;
+    using field_value_type = typename CurveGroup::field_type::value_type;
+    using scalar_value_type = typename CurveGroup::curve_type::scalar_field_type::value_type;
+
+    std::vector<group_value_type> members = {group_value_type::zero(), group_value_type::one(),
+                                             group_value_type::one() * scalar_value_type(0x1234567890abcdef)};
+    for (auto &P : members) {
+        BOOST_CHECK(P.is_in_subgroup());
+    }
+    BOOST_CHECK(curves::detail::is_in_subgroup_batch(members.begin(), members.end()));
+
+    // the first point found on the curve has a component outside of the prime-order subgroup
+    field_value_type x = field_value_type::one();
+    field_value_type y2 = x.squared() * x + group_value_type::params_type::b;
+    while (!y2.is_square()) {
+        x = x + field_value_type::one();
+        y2 = x.squared() * x + group_value_type::params_type::b;
+    }
+    group_value_type Q(x, y2.sqrt(), field_value_type::one());
+    BOOST_CHECK(Q.is_well_formed());
+    BOOST_CHECK(!Q.is_in_subgroup());
+
+    members.push_back(Q);
+    BOOST_CHECK(!curves::detail::is_in_subgroup_batch(members.begin(), members.end()));
+}
+
+/**
+ * A toy short Weierstrass curve y^2 = x^3 + 588 * x + 360 over a 61-bit prime field. All of its 3-torsion is
+ * rational, which is what the map to the Hessian form needs, and none of the library curves have it.
+ */
+namespace toy {
+    struct base_field : public fields::field<61> {
+        typedef fields::field<61> policy_type;
+
+        constexpr static const std::size_t modulus_bits = policy_type::modulus_bits;
+        typedef typename policy_type::integral_type integral_type;
+
+        typedef typename policy_type::extended_integral_type extended_integral_type;
+
+        constexpr static const std::size_t number_bits = policy_type::number_bits;
+
+        constexpr static const integral_type modulus = integral_type(0x1fffffffffffffe1_cppui64);
+
+        typedef typename policy_type::modular_backend modular_backend;
+        constexpr static const modular_params_type modulus_params = modulus;
+        typedef nil::crypto3::multiprecision::number<nil::crypto3::multiprecision::backends::modular_adaptor<
+            modular_backend,
+            nil::crypto3::multiprecision::backends::modular_params_ct<modular_backend, modulus_params>>>
+            modular_type;
+
+        typedef typename fields::detail::element_fp<fields::params<base_field>> value_type;
+
+        constexpr static const std::size_t value_bits = modulus_bits;
+        constexpr static const std::size_t arity = 1;
+    };
+
+    constexpr typename base_field::integral_type const base_field::modulus;
+
+    template<typename Form, typename Coordinates>
+    struct g1;
+
+    template<typename Form>
+    struct g1_params;
+
+    struct curve {
+        using base_field_type = base_field;
+
+        template<typename Coordinates = curves::coordinates::affine,
+                 typename Form = curves::forms::short_weierstrass>
+        using g1_type = g1<Form, Coordinates>;
+    };
+
+    template<typename Form, typename Coordinates>
+    struct g1 {
+        using params_type = g1_params<Form>;
+        using curve_type = curve;
+        using field_type = typename params_type::field_type;
+
+        using value_type = curves::detail::curve_element<params_type, Form, Coordinates>;
+    };
+
+    template<>
+    struct g1_params<curves::forms::short_weierstrass> {
+        using field_type = base_field;
+        using integral_type = typename base_field::integral_type;
+
+        template<typename Coordinates>
+        using group_type = g1<curves::forms::short_weierstrass, Coordinates>;
+
+        constexpr static const integral_type a = integral_type(588);
+        constexpr static const integral_type b = integral_type(360);
+
+        constexpr static const std::array<typename field_type::value_type, 2> zero_fill = {
+            field_type::value_type::zero(), field_type::value_type::one()};
+        constexpr static const std::array<typename field_type::value_type, 2> one_fill = {
+            typename field_type::value_type(0x0a), typename field_type::value_type(0x2f01d3fa435d27f_cppui64)};
+    };
+
+    /// The Hessian form the map sends the generator to, with alpha^3 = 8 * l^3 - 54 * y0 for the point (x0, y0)
+    /// of order 3 and the slope l of its tangent
+    template<>
+    struct g1_params<curves::forms::hessian> {
+        using field_type = base_field;
+        using integral_type = typename base_field::integral_type;
+
+        template<typename Coordinates>
+        using group_type = g1<curves::forms::hessian, Coordinates>;
+
+        constexpr static const integral_type d = integral_type(0x9f2dded4fea4cba_cppui64);
+        constexpr static const integral_type alpha = integral_type(0x6f47e92684b0d87_cppui64);
+        constexpr static const integral_type omega = integral_type(0x1c2f2958a4f8ea10_cppui64);
+
+        constexpr static const std::array<typename field_type::value_type, 2> one_fill = {
+            typename field_type::value_type(0x2bdf571a481e9a2_cppui64),
+            typename field_type::value_type(0x1f69f305133ee12d_cppui64)};
+    };
+
+    constexpr typename base_field::integral_type const g1_params<curves::forms::short_weierstrass>::a;
+    constexpr typename base_field::integral_type const g1_params<curves::forms::short_weierstrass>::b;
+    constexpr std::array<typename base_field::value_type, 2> const
+        g1_params<curves::forms::short_weierstrass>::zero_fill;
+    constexpr std::array<typename base_field::value_type, 2> const
+        g1_params<curves::forms::short_weierstrass>::one_fill;
+    constexpr typename base_field::integral_type const g1_params<curves::forms::hessian>::d;
+    constexpr typename base_field::integral_type const g1_params<curves::forms::hessian>::alpha;
+    constexpr typename base_field::integral_type const g1_params<curves::forms::hessian>::omega;
+    constexpr std::array<typename base_field::value_type, 2> const g1_params<curves::forms::hessian>::one_fill;
+}    // namespace toy
+
 BOOST_AUTO_TEST_SUITE(curves_manual_tests)
 /**/
 
@@ -430,6 +569,12 @@ BOOST_DATA_TEST_CASE(curve_operation_test_jubjub_g1, string_data("curve_operatio
     curve_operation_test_twisted_edwards<policy_type>(data_set, fp_curve_twisted_edwards_test_init<policy_type>);
 }
 
+BOOST_DATA_TEST_CASE(curve_operation_test_jubjub_g1_affine, string_data("curve_operation_test_jubjub_g1"), data_set) {
+    using policy_type = curves::jubjub::g1_type<curves::coordinates::affine>;
+
+    curve_operation_test_twisted_edwards<policy_type>(data_set, fp_curve_twisted_edwards_test_init<policy_type>);
+}
+
 BOOST_AUTO_TEST_CASE(curve_operation_test_babyjubjub_g1) {
     using policy_type = curves::babyjubjub::g1_type<>;
 
@@ -510,6 +655,246 @@ BOOST_DATA_TEST_CASE(curve_operation_test_babyjubjub_montgomery_affine,
     curve_operation_test_montgomery<policy_type>(data_set, fp_curve_twisted_edwards_test_init<policy_type>);
 }
 
+BOOST_AUTO_TEST_CASE(curve_operation_test_montgomery_ladder) {
+    using nil::crypto3::multiprecision::cpp_int;
+
+    // RFC 7748, section 5.2, first X25519 test vector (clamped scalar, decoded u-coordinates)
+    using x25519_type = curves::curve25519::g1_type<curves::coordinates::xz, curves::forms::montgomery>;
+    using x25519_field_value_type = typename x25519_type::field_type::value_type;
+
+    typename x25519_type::value_type U(
+        x25519_field_value_type(0x4c1cabd0a603a9103b35b326ec2466727c5fb124a4c19435db3030586768dbe6_cppui255),
+        x25519_field_value_type::one());
+    cpp_int k("0x449a44ba44226a50185afcc10a4c1462dd5e46824b15163b9d7c52f06be346a0");
+
+    BOOST_CHECK(U.is_well_formed());
+    BOOST_CHECK_EQUAL((U * k).to_affine_x(),
+                      x25519_field_value_type(
+                          0x5285a2775507b454f7711c4903cfec324f088df24dea948e90c6e99d3755dac3_cppui255));
+
+    // the ladder agrees with affine double-and-add
+    using jubjub_type = curves::jubjub::g1_type<curves::coordinates::affine, curves::forms::montgomery>;
+
+    typename jubjub_type::value_type P = jubjub_type::value_type::one();
+    cpp_int s("0x1234567890abcdef1234567890abcdef");
+
+    BOOST_CHECK_EQUAL((P.to_xz() * s).to_affine_x(), (P * s).X);
+    BOOST_CHECK_EQUAL(P.to_xz().doubled().to_affine_x(), P.doubled().X);
+    BOOST_CHECK((P.to_xz() * cpp_int(0)).is_zero());
+}
+
+template<typename AffineValueType, typename MapType>
+void check_curve_form_map(const AffineValueType &P, const AffineValueType &Q, const AffineValueType &P_plus_Q,
+                          const AffineValueType &P_minus_Q, const AffineValueType &P_doubled,
+                          const AffineValueType &P_times_k, const nil::crypto3::multiprecision::cpp_int &k,
+                          MapType map) {
+    auto p = map(P);
+    auto q = map(Q);
+
+    BOOST_CHECK(p.is_well_formed());
+    BOOST_CHECK(q.is_well_formed());
+    BOOST_CHECK(p + q == map(P_plus_Q));
+    BOOST_CHECK(p - q == map(P_minus_Q));
+    BOOST_CHECK(p.doubled() == map(P_doubled));
+    BOOST_CHECK(p + p == p.doubled());
+    BOOST_CHECK(p * k == map(P_times_k));
+    BOOST_CHECK((p - p).is_zero());
+    BOOST_CHECK(p + decltype(p)::zero() == p);
+    BOOST_CHECK(decltype(p)::zero() + p == p);
+}
+
+BOOST_AUTO_TEST_CASE(curve_operation_test_bls12_377_forms) {
+    using nil::crypto3::multiprecision::cpp_int;
+
+    using curve_type = curves::bls12<377>;
+    using g1_type = curve_type::g1_type<>;
+    using affine_value_type = typename curve_type::g1_type<curves::coordinates::affine>::value_type;
+
+    typename g1_type::value_type P = g1_type::value_type::one();
+    typename g1_type::value_type Q = P * cpp_int("0x3b9aca07");
+    cpp_int k("0x1234567890abcdef1234567890abcdef");
+
+    affine_value_type p = P.to_affine();
+    affine_value_type q = Q.to_affine();
+    affine_value_type p_plus_q = (P + Q).to_affine();
+    affine_value_type p_minus_q = (P - Q).to_affine();
+    affine_value_type p_doubled = P.doubled().to_affine();
+    affine_value_type p_times_k = (P * k).to_affine();
+
+    using twisted_hessian_value_type =
+        typename curve_type::g1_type<curves::coordinates::projective, curves::forms::twisted_hessian>::value_type;
+    using jacobi_quartic_value_type =
+        typename curve_type::g1_type<curves::coordinates::xyz, curves::forms::jacobi_quartics>::value_type;
+    using jacobi_intersection_value_type =
+        typename curve_type::g1_type<curves::coordinates::projective, curves::forms::jacobi_intersections>::value_type;
+
+    // the generators of the other forms are the images of the short Weierstrass generator
+    BOOST_CHECK(p.to_twisted_hessian() == twisted_hessian_value_type::one());
+    BOOST_CHECK(p.to_jacobi_quartic() == jacobi_quartic_value_type::one());
+    BOOST_CHECK(p.to_jacobi_intersection() == jacobi_intersection_value_type::one());
+
+    check_curve_form_map(p, q, p_plus_q, p_minus_q, p_doubled, p_times_k, k,
+                         [](const affine_value_type &X) { return X.to_twisted_hessian(); });
+    check_curve_form_map(p, q, p_plus_q, p_minus_q, p_doubled, p_times_k, k,
+                         [](const affine_value_type &X) { return X.to_jacobi_quartic(); });
+    check_curve_form_map(p, q, p_plus_q, p_minus_q, p_doubled, p_times_k, k,
+                         [](const affine_value_type &X) { return X.to_jacobi_intersection(); });
+
+    // mixed addition takes the second point with Z = 1
+    BOOST_CHECK(q.to_twisted_hessian().mixed_add(twisted_hessian_value_type::one()) == p_plus_q.to_twisted_hessian());
+    BOOST_CHECK(twisted_hessian_value_type::zero().mixed_add(twisted_hessian_value_type::one()) ==
+                twisted_hessian_value_type::one());
+    BOOST_CHECK(twisted_hessian_value_type::one().mixed_add(twisted_hessian_value_type::zero()) ==
+                twisted_hessian_value_type::one());
+    BOOST_CHECK(q.to_jacobi_quartic().mixed_add(jacobi_quartic_value_type::one()) == p_plus_q.to_jacobi_quartic());
+    BOOST_CHECK(q.to_jacobi_intersection().mixed_add(jacobi_intersection_value_type::one()) ==
+                p_plus_q.to_jacobi_intersection());
+}
+
+BOOST_AUTO_TEST_CASE(curve_operation_test_toy_hessian) {
+    using nil::crypto3::multiprecision::cpp_int;
+
+    using affine_value_type = typename toy::curve::g1_type<>::value_type;
+    using hessian_value_type =
+        typename toy::curve::g1_type<curves::coordinates::projective, curves::forms::hessian>::value_type;
+
+    affine_value_type p = affine_value_type::one();
+    affine_value_type q = p * cpp_int("0x3b9aca07");
+    cpp_int k("0x1234567890abcdef");
+
+    BOOST_CHECK(p.to_hessian() == hessian_value_type::one());
+    BOOST_CHECK(affine_value_type::zero().to_hessian().is_zero());
+
+    check_curve_form_map(p, q, p + q, p - q, p.doubled(), p * k, k,
+                         [](const affine_value_type &X) { return X.to_hessian(); });
+
+    // the addition is unified: the rotated formula doubles, and adds points to their negatives and to zero
+    hessian_value_type P = p.to_hessian();
+    BOOST_CHECK(hessian_value_type(P).double_inplace() == P.doubled());
+    BOOST_CHECK((hessian_value_type(P) += P) == P.doubled());
+    BOOST_CHECK(q.to_hessian().mixed_add(hessian_value_type::one()) == (p + q).to_hessian());
+    BOOST_CHECK(hessian_value_type(P).mixed_add_inplace(hessian_value_type::one()) == P.doubled());
+    BOOST_CHECK((hessian_value_type(P) -= P).is_zero());
+}
+
+template<typename CurveGroup, typename ReferenceCurveGroup>
+void check_complete_addition() {
+    using value_type = typename CurveGroup::value_type;
+    using reference_value_type = typename ReferenceCurveGroup::value_type;
+
+    value_type P = value_type::one();
+    value_type Q = P.doubled() + P;
+    value_type O = value_type::zero();
+
+    // the cases the incomplete formulas branch on
+    BOOST_CHECK(P + P == P.doubled());
+    BOOST_CHECK((P - P).is_zero());
+    BOOST_CHECK(P + O == P);
+    BOOST_CHECK(O + P == P);
+    BOOST_CHECK((O + O).is_zero());
+    BOOST_CHECK(O.doubled().is_zero());
+    BOOST_CHECK(P.mixed_add(P) == P.doubled());
+    BOOST_CHECK(O.mixed_add(P) == P);
+    BOOST_CHECK(Q.mixed_add(-P) == P.doubled());
+
+    BOOST_CHECK(P + Q == Q + P);
+    BOOST_CHECK((P + Q) - Q == P);
+    BOOST_CHECK((P.doubled() + Q).is_well_formed());
+
+    nil::crypto3::multiprecision::cpp_int k("0x1234567890abcdef1234567890abcdef");
+    reference_value_type R = reference_value_type::one();
+
+    BOOST_CHECK((P * k).to_affine() == (R * k).to_affine());
+    BOOST_CHECK((P + Q).to_affine() == (R.doubled().doubled()).to_affine());
+}
+
+BOOST_AUTO_TEST_CASE(curve_operation_test_complete_projective) {
+    using curves::coordinates::projective_with_a4_0;
+
+    check_complete_addition<curves::secp_k1<256>::g1_type<projective_with_a4_0>, curves::secp_k1<256>::g1_type<>>();
+    check_complete_addition<curves::pallas::g1_type<projective_with_a4_0>, curves::pallas::g1_type<>>();
+    check_complete_addition<curves::vesta::g1_type<projective_with_a4_0>, curves::vesta::g1_type<>>();
+    check_complete_addition<curves::secp_r1<256>::g1_type<>,
+                            curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>();
+}
+
+BOOST_AUTO_TEST_CASE(curve_operation_test_complete_twisted_edwards) {
+    using curves::coordinates::affine;
+
+    check_complete_addition<curves::jubjub::g1_type<>, curves::jubjub::g1_type<affine>>();
+    check_complete_addition<curves::babyjubjub::g1_type<>, curves::babyjubjub::g1_type<affine>>();
+    check_complete_addition<curves::curve25519::g1_type<>, curves::curve25519::g1_type<affine>>();
+}
+
+template<typename CurveGroup>
+void check_inplace_arithmetic() {
+    using value_type = typename CurveGroup::value_type;
+
+    value_type P = value_type::one();
+    value_type Q = P.doubled() + P;
+    value_type R = P;
+
+    R += Q;
+    BOOST_CHECK(R == P + Q);
+    R -= P;
+    BOOST_CHECK(R == Q);
+    R.double_inplace();
+    BOOST_CHECK(R == Q.doubled());
+    R.mixed_add_inplace(P);
+    BOOST_CHECK(R == Q.doubled() + P);
+    BOOST_CHECK(R == P * nil::crypto3::multiprecision::cpp_int(7));
+    BOOST_CHECK(&(R += P) == &R);
+    BOOST_CHECK(&(R = Q) == &R);
+}
+
+BOOST_AUTO_TEST_CASE(curve_operation_test_inplace) {
+    check_inplace_arithmetic<curves::bls12<381>::g1_type<>>();
+    check_inplace_arithmetic<curves::bls12<381>::g2_type<>>();
+    check_inplace_arithmetic<curves::mnt4<298>::g1_type<>>();
+    check_inplace_arithmetic<curves::jubjub::g1_type<>>();
+    check_inplace_arithmetic<curves::curve25519::g1_type<>>();
+}
+
+template<typename AffineGroup>
+void check_batch_affine() {
+    using value_type = typename AffineGroup::value_type;
+
+    std::vector<value_type> P;
+    std::vector<value_type> Q;
+    value_type R = value_type::one();
+    for (std::size_t i = 0; i < 8; ++i) {
+        P.push_back(R);
+        Q.push_back(R.doubled());
+        R = R + value_type::one();
+    }
+    P.push_back(value_type::zero());
+    Q.push_back(R);
+    P.push_back(R);
+    Q.push_back(value_type::zero());
+    P.push_back(R);
+    Q.push_back(R);
+    P.push_back(R);
+    Q.push_back(-R);
+
+    std::vector<value_type> sums = P;
+    batch_affine_add(sums.begin(), sums.end(), Q.begin());
+    std::vector<value_type> doubles = P;
+    batch_affine_double(doubles.begin(), doubles.end());
+
+    BOOST_CHECK(doubles[1] == P[3]);
+    BOOST_CHECK(sums[0] == P[2]);
+    for (std::size_t i = 0; i < P.size(); ++i) {
+        BOOST_CHECK(sums[i] == P[i] + Q[i]);
+        BOOST_CHECK(doubles[i] == P[i].doubled());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(curve_operation_test_batch_affine) {
+    check_batch_affine<curves::bls12<381>::g1_type<curves::coordinates::affine>>();
+    check_batch_affine<curves::jubjub::g1_type<curves::coordinates::affine>>();
+    check_batch_affine<curves::jubjub::g1_type<curves::coordinates::affine, curves::forms::montgomery>>();
+}
+
 BOOST_DATA_TEST_CASE(curve_operation_test_edwards_g1, string_data("curve_operation_test_edwards_g1"), data_set) {
     using policy_type = curves::edwards<183>::g1_type<>;
 
@@ -614,4 +999,13 @@ BOOST_DATA_TEST_CASE(curve_operation_test_vesta, string_data("curve_operation_te
                                                       fp_curve_test_init<policy_type>);
 }
 
+BOOST_AUTO_TEST_CASE(subgroup_check_test) {
+    check_subgroup_membership<curves::bls12<381>::g1_type<>>();
+    check_subgroup_membership<curves::bls12<381>::g2_type<>>();
+    check_subgroup_membership<curves::bls12<377>::g1_type<>>();
+    check_subgroup_membership<curves::bls12<377>::g2_type<>>();
+    // G1 of alt_bn128 has cofactor 1
+    check_subgroup_membership<curves::alt_bn128<254>::g2_type<>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -66,6 +66,7 @@
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp2.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/fp_batch.hpp>
 
 using namespace nil::crypto3::algebra;
 
@@ -429,6 +430,10 @@ void field_not_square_test(const std::vector<const char *> &test_set) {
     typedef typename FieldType::value_type value_type;
     typedef typename value_type::integral_type integral_type;
 
+    BOOST_CHECK_EQUAL(value_type::zero().is_square(), true);
+    BOOST_CHECK_EQUAL(value_type::one().is_square(), true);
+    BOOST_CHECK_EQUAL((-value_type::one()).is_square(), (FieldType::modulus % 4) == 1);
+
     for (auto &not_square : test_set) {
         BOOST_CHECK_EQUAL(value_type(integral_type(not_square)).is_square(), false);
         BOOST_CHECK_EQUAL(value_type(integral_type(not_square)).pow(2).is_square(), true);
@@ -440,6 +445,9 @@ void field_not_square_test(const std::vector<std::array<const char *, 2>> &test_
     typedef typename FieldType::value_type value_type;
     typedef typename value_type::underlying_type::integral_type integral_type;
 
+    BOOST_CHECK_EQUAL(value_type::zero().is_square(), true);
+    BOOST_CHECK_EQUAL(value_type::one().is_square(), true);
+
     for (auto &not_square : test_set) {
         BOOST_CHECK_EQUAL(value_type(integral_type(not_square[0]), integral_type(not_square[1])).is_square(), false);
         BOOST_CHECK_EQUAL(value_type(integral_type(not_square[0]), integral_type(not_square[1])).pow(2).is_square(),
@@ -959,4 +967,73 @@ BOOST_AUTO_TEST_CASE(field_not_square_manual_test_bls12_381_fq2) {
     field_not_square_test<policy_type>(not_squares);
 }
 
+BOOST_AUTO_TEST_CASE(fixed_exponent_chain_manual_test_bls12_381_fq) {
+    using policy_type = fields::bls12_fq<381>;
+    typedef typename policy_type::value_type value_type;
+    typedef typename policy_type::integral_type integral_type;
+
+    const integral_type x_integral(
+        "2198813024736262418862624208722431428727386342096434442131098011254290736950470402567005442346025939101581466592012");
+    const value_type x(x_integral);
+    const integral_type exponents[] = {integral_type(1), integral_type(0xd201000000010000), policy_type::modulus - 2};
+
+    // oracles independent of the exponentiation code: Fermat, the identity and plain integer powm
+    const auto chain_power = [&x](const integral_type &exponent) {
+        return fields::detail::power(x, fields::detail::fixed_exponent_chain<policy_type::modulus_bits>(exponent));
+    };
+    BOOST_CHECK_EQUAL(chain_power(policy_type::modulus - 2) * x, value_type::one());
+    BOOST_CHECK_EQUAL(x.pow(policy_type::modulus - 2) * x, value_type::one());
+    BOOST_CHECK_EQUAL(chain_power(integral_type(1)), x);
+    BOOST_CHECK_EQUAL(x.pow(integral_type(1)), x);
+    const value_type expected(
+        nil::crypto3::multiprecision::powm(x_integral, integral_type(0xd201000000010000), policy_type::modulus));
+    BOOST_CHECK_EQUAL(chain_power(integral_type(0xd201000000010000)), expected);
+    BOOST_CHECK_EQUAL(x.pow(integral_type(0xd201000000010000)), expected);
+
+    for (const integral_type &exponent : exponents) {
+        BOOST_CHECK_EQUAL(fields::detail::power(x, fields::detail::fixed_exponent_chain<policy_type::modulus_bits>(exponent)),
+                          x.pow(exponent));
+        BOOST_CHECK_EQUAL(
+            fields::detail::power(x, fields::detail::fixed_exponent_chain<policy_type::modulus_bits, 1>(exponent)),
+            x.pow(exponent));
+
+        for (std::size_t window = 2; window <= fields::detail::max_power_window; ++window) {
+            BOOST_CHECK_EQUAL(fields::detail::sliding_window_power(x, exponent, window),
+                              fields::detail::sliding_window_power(x, exponent, 1));
+        }
+    }
+}
+
+template<typename FieldType, std::size_t Lanes>
+void field_batch_test() {
+    typedef typename FieldType::value_type value_type;
+    typedef typename value_type::integral_type integral_type;
+    typedef fields::detail::element_fp_batch<fields::params<FieldType>, Lanes> batch_type;
+
+    std::array<value_type, Lanes> a, b;
+    for (std::size_t i = 0; i < Lanes; ++i) {
+        a[i] = value_type(FieldType::modulus - integral_type(3 * i + 1));
+        b[i] = value_type(integral_type(0x9e3779b97f4a7c15) * integral_type(i + 1)).squared();
+    }
+
+    const batch_type A(a), B(b);
+    for (std::size_t i = 0; i < Lanes; ++i) {
+        BOOST_CHECK_EQUAL(A[i], a[i]);
+        BOOST_CHECK_EQUAL((A + B)[i], a[i] + b[i]);
+        BOOST_CHECK_EQUAL((A - B)[i], a[i] - b[i]);
+        BOOST_CHECK_EQUAL((A * B)[i], a[i] * b[i]);
+        BOOST_CHECK_EQUAL(A.squared()[i], a[i].squared());
+        BOOST_CHECK_EQUAL(batch_type::one()[i], value_type::one());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(field_batch_manual_test) {
+    field_batch_test<fields::bls12_fq<381>, 8>();
+    field_batch_test<fields::bls12_fr<381>, 8>();
+    field_batch_test<fields::bls12_fr<381>, 3>();
+    // four lanes take the AVX2 kernel even where the IFMA one is available
+    field_batch_test<fields::bls12_fq<381>, 4>();
+    field_batch_test<fields::bls12_fr<381>, 4>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -42,7 +42,11 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/ep2.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
 
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
 
 #include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
 
@@ -108,6 +112,34 @@ namespace boost {
                 }
             };
 
+            template<>
+            struct print_log_value<typename curves::alt_bn128_254::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::alt_bn128_254::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::pallas::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::pallas::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::vesta::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::vesta::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::secp256k1::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::secp256k1::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
             template<template<typename, typename> class P, typename K, typename V>
             struct print_log_value<P<K, V>> {
                 void operator()(std::ostream &, P<K, V> const &) {
@@ -166,6 +198,22 @@ void check_hash_to_curve(const std::string &msg_str, const GroupValueType &expec
     BOOST_CHECK_EQUAL(result, expected);
 }
 
+template<typename H2CType,
+         typename SamplesType,
+         typename DstType,
+         typename = typename std::enable_if<std::is_same<std::uint8_t, typename DstType::value_type>::value>::type>
+void check_hash_to_curve_batch(const SamplesType &samples, const DstType &dst) {
+    std::vector<std::vector<std::uint8_t>> msgs;
+    for (auto &s : samples) {
+        msgs.emplace_back(std::get<0>(s).begin(), std::get<0>(s).end());
+    }
+    auto result = H2CType::hash_to_curve_batch(msgs, dst);
+    BOOST_CHECK_EQUAL(result.size(), samples.size());
+    for (std::size_t i = 0; i < result.size(); i++) {
+        BOOST_CHECK_EQUAL(result[i], std::get<1>(samples[i]));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(h2c_manual_tests)
 
 BOOST_AUTO_TEST_CASE(expand_message_xmd_sha256_test) {
@@ -511,6 +559,7 @@ BOOST_AUTO_TEST_CASE(hash_to_curve_bls12_381_g1_h2c_sha256_test) {
     for (auto &s : samples) {
         check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
     }
+    check_hash_to_curve_batch<h2c_type>(samples, dst);
 }
 
 BOOST_AUTO_TEST_CASE(hash_to_curve_bls12_381_g2_h2c_sha256_test) {
@@ -596,6 +645,245 @@ BOOST_AUTO_TEST_CASE(hash_to_curve_bls12_381_g2_h2c_sha256_test) {
     for (auto &s : samples) {
         check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
     }
+    check_hash_to_curve_batch<h2c_type>(samples, dst);
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_bn254_h2c_sha256_test) {
+    // BN254G1_XMD:SHA-256_SVDW_RO_, the suite used by gnark-crypto
+    using curve_type = alt_bn128_254;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(integral_type("4790658965958450548702669593570794336562317867247372723806336874591549759110"),
+                          integral_type("1163238807669877429342450210709044731909255047583162173012265677391336920021"),
+                          1)},
+        {"abc",
+         group_value_type(integral_type("16267524812466668166267883771992486438338357688076900798565538061554532963281"),
+                          integral_type("1844916233815282837483764409618609279507070495361570126601873459268232811805"),
+                          1)},
+        {"abcdef0123456789",
+         group_value_type(integral_type("11077683243901808951859264683654586764079462418577485658911541848692394044746"),
+                          integral_type("4858124309270455482359664916577923636817363175462672327824733704859450489677"),
+                          1)},
+        {"q128_"
+         "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq"
+         "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq",
+         group_value_type(integral_type("449076125358095157945547407089359408531318284903480972761046551095956160348"),
+                          integral_type("3427911873443593747709927415036866402371639925174562008506349359915732032632"),
+                          1)},
+        {"a512_"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+         group_value_type(integral_type("763925112321939766609678334678065587309331741428777416269918389033192485838"),
+                          integral_type("12636771015364464547273606234110225240317241569495907283228710706019336772016"),
+                          1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+    check_hash_to_curve_batch<h2c_type>(samples, dst);
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_pallas_h2c_sha256_test) {
+    // No standard vectors exist for this suite; these come from an independent reference implementation
+    using curve_type = pallas;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(integral_type("4002939958301323116492795096933969050258133803640671061281895022877905918603"),
+                          integral_type("22868292373298381922474562347324748355781888260633754184893577164189916983622"),
+                          1)},
+        {"abc",
+         group_value_type(integral_type("24098166527885906846180490619812118413849786001843221727655672376085930846833"),
+                          integral_type("468276367126329304023891759757627524497079410503291193270903742079630873623"),
+                          1)},
+        {"abcdef0123456789",
+         group_value_type(integral_type("11738666724075960555880923412624036010619308489887174747216707127279355699145"),
+                          integral_type("21974256835427188419849761070207697580559737431104907135892789167891750406164"),
+                          1)},
+        {"q128_"
+         "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq"
+         "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq",
+         group_value_type(integral_type("19678210151601498287183653044298765151080696196004149667766948569271936963581"),
+                          integral_type("19107791351906816161463770045007945192564721699369363612669863656182509844385"),
+                          1)},
+        {"a512_"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+         group_value_type(integral_type("9991512366979156013842433035912725916043356901175786745629249019910687770289"),
+                          integral_type("3623452886314960724809481534300489356728985298513735023437564829085891867045"),
+                          1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+    check_hash_to_curve_batch<h2c_type>(samples, dst);
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_vesta_h2c_sha256_test) {
+    // No standard vectors exist for this suite; these come from an independent reference implementation
+    using curve_type = vesta;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(integral_type("1748397945484132063096963288362882422829544099409361188227564652188453912973"),
+                          integral_type("10938124364223235010286439042147083685534009011713458983132112945817284577830"),
+                          1)},
+        {"abc",
+         group_value_type(integral_type("26152733553050984477546958255275499958933897943566291271232468936904486068843"),
+                          integral_type("7856349467404538192403684782106108972781232135311794139098675028493086288063"),
+                          1)},
+        {"abcdef0123456789",
+         group_value_type(integral_type("28051873770835654627514286151400000233519077001867992577969727612773804684116"),
+                          integral_type("4963074871640298770281672231615854879108434764324887100176435497236999240821"),
+                          1)},
+        {"q128_"
+         "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq"
+         "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq",
+         group_value_type(integral_type("14283754253553228909370227990329915790201674521280443282204104460771588669068"),
+                          integral_type("797745128632507617672918551538837568665262696033629286603283590603392363037"),
+                          1)},
+        {"a512_"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+         group_value_type(integral_type("20602620707128954515258321050380662910849913292791960190633016311040900976094"),
+                          integral_type("1765691964642529680137410820670346845255528032763150884261718882983899617565"),
+                          1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+    check_hash_to_curve_batch<h2c_type>(samples, dst);
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_secp256k1_h2c_sha256_test) {
+    // https://datatracker.ietf.org/doc/html/rfc9380#appendix-J.8.1
+    using curve_type = secp256k1;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(integral_type("87654846584422849836571930156466438379984710599888121545025567473301233275718"),
+                          integral_type("45673711333516174500892987253036094404176536844955599116957274814081860440167"),
+                          1)},
+        {"abc",
+         group_value_type(integral_type("23279756896471199523010870052867415078463234370173863328176697381984636972107"),
+                          integral_type("57707937931845145617875053157352479097727553907460720360838645569336604062198"),
+                          1)},
+        {"abcdef0123456789",
+         group_value_type(integral_type("84478703977314533686125373011176518918069417287003338656136752748371997560378"),
+                          integral_type("30853176071399710458335513638499502590048897055546040301024301883825591998504"),
+                          1)},
+        {"q128_"
+         "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq"
+         "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq",
+         group_value_type(integral_type("102262428709100978756793022659845432315019126868557481312314604368156864057577"),
+                          integral_type("109572993580017857525517803897445772239483468103890022576147795553142490650739"),
+                          1)},
+        {"a512_"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+         "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+         group_value_type(integral_type("103029844754233638164005859737962584871386781778635321136935904547076618832280"),
+                          integral_type("59830622832405469468972190205738367232249873093700477587008730083596009880230"),
+                          1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+    check_hash_to_curve_batch<h2c_type>(samples, dst);
+}
+
+template<typename GroupType, typename ClearCofactor, typename IsInSubgroup>
+void check_clear_cofactor(const typename GroupType::field_type::value_type &u,
+                          ClearCofactor clear_cofactor,
+                          IsInSubgroup is_in_subgroup) {
+    using suite_type = h2c_suite<GroupType>;
+    using group_value_type = typename GroupType::value_type;
+
+    // map_to_curve output is on the curve, but almost never in the prime order subgroup
+    group_value_type Q = map_to_curve<GroupType>::process(u);
+    group_value_type R = clear_cofactor(Q);
+
+    BOOST_CHECK_EQUAL(R, Q * suite_type::h_eff);
+    BOOST_CHECK(!is_in_subgroup(Q));
+    BOOST_CHECK(is_in_subgroup(R));
+    BOOST_CHECK(is_in_subgroup(group_value_type::one()));
+}
+
+BOOST_AUTO_TEST_CASE(clear_cofactor_bls12_381_test) {
+    using endomorphisms = bls12_endomorphisms<381>;
+    using g1_type = typename bls12_381::g1_type<>;
+    using g2_type = typename bls12_381::g2_type<>;
+    using g1_value_type = typename g1_type::value_type;
+    using g2_value_type = typename g2_type::value_type;
+    using g1_field_value_type = typename g1_type::field_type::value_type;
+    using g2_field_value_type = typename g2_type::field_type::value_type;
+
+    for (std::size_t i = 1; i < 4; i++) {
+        check_clear_cofactor<g1_type>(
+            g1_field_value_type(i * 1234567),
+            [](const g1_value_type &P) { return endomorphisms::clear_cofactor_g1(P); },
+            [](const g1_value_type &P) { return endomorphisms::is_in_g1(P); });
+        check_clear_cofactor<g2_type>(
+            g2_field_value_type(i * 1234567, i * 7654321),
+            [](const g2_value_type &P) { return endomorphisms::clear_cofactor_g2(P); },
+            [](const g2_value_type &P) { return endomorphisms::is_in_g2(P); });
+    }
 }
 
 BOOST_AUTO_TEST_SUITE_END()
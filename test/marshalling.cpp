@@ -0,0 +1,594 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_marshalling_test
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+#include <nil/crypto3/algebra/marshalling.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/mnt6.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+using namespace nil::marshalling;
+
+// A point of E(Fp) or E'(Fp2) outside the prime-order subgroup: the cofactors are large, so the first x with
+// x^3 + b a square almost surely gives one
+template<typename GroupValueType>
+GroupValueType point_outside_subgroup() {
+    using field_value_type = typename GroupValueType::field_type::value_type;
+
+    field_value_type x = field_value_type::one();
+    while (true) {
+        const field_value_type y2 = x.squared() * x + GroupValueType::params_type::b;
+        if (y2.is_square()) {
+            const GroupValueType result(x, y2.sqrt(), field_value_type::one());
+            if (!result.is_in_subgroup()) {
+                return result;
+            }
+        }
+        x = x + field_value_type::one();
+    }
+}
+
+// Compressed encodings of valid points interleaved with invalid ones, and the points they decode to, where the
+// invalid encodings decode to the point at infinity. x is encoded as (0, ..., 0, k) with k small, one base field
+// element per coordinate of x, and is placed off the curve.
+template<typename GroupValueType, typename Serializer>
+void make_compressed_batch(std::size_t count, std::size_t field_elements, std::vector<std::uint8_t> &octets,
+                           std::vector<GroupValueType> &expected, std::vector<bool> &valid) {
+    using field_value_type = typename GroupValueType::field_type::value_type;
+    const std::size_t size = field_elements * Serializer::sizeof_field_element;
+
+    std::vector<std::uint8_t> off_curve(size, 0);
+    field_value_type x = field_value_type::zero();
+    for (std::uint8_t k = 1;; ++k) {
+        x = x + field_value_type::one();
+        if (!(x.squared() * x + GroupValueType::params_type::b).is_square()) {
+            off_curve[0] = 0x80;
+            off_curve[size - 1] = k;
+            break;
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const GroupValueType P = random_element<typename GroupValueType::group_type>();
+        const auto compressed = Serializer::point_to_octets_compress(P);
+        std::vector<std::uint8_t> encoding(compressed.begin(), compressed.end());
+
+        bool is_valid = false;
+        switch (i % 6) {
+            case 0:
+                // missing compression bit
+                encoding[0] &= 0x7F;
+                break;
+            case 1:
+                // x >= p
+                std::fill(encoding.begin(), encoding.end(), 0xFF);
+                encoding[0] = 0x9F;
+                break;
+            case 2:
+                encoding = off_curve;
+                break;
+            case 3:
+                // infinity with a non-zero payload
+                std::fill(encoding.begin(), encoding.end(), 0);
+                encoding[0] = 0xC0;
+                encoding[size - 1] = 1;
+                break;
+            default:
+                is_valid = true;
+        }
+
+        octets.insert(octets.end(), encoding.begin(), encoding.end());
+        expected.push_back(is_valid ? P : GroupValueType::zero());
+        valid.push_back(is_valid);
+    }
+}
+
+template<typename Codec>
+void check_native_round_trip(const std::vector<typename Codec::value_type> &elements) {
+    std::vector<std::uint8_t> buffer(Codec::buffer_size(elements.size()));
+    BOOST_CHECK(Codec::export_elements(elements.begin(), elements.end(), buffer.data()) ==
+                buffer.data() + buffer.size());
+
+    std::vector<typename Codec::value_type> imported;
+    BOOST_CHECK(Codec::import_elements(buffer.data(), buffer.data() + buffer.size(), std::back_inserter(imported)));
+    BOOST_CHECK(imported == elements);
+
+    // truncated by one octet, and shorter than the header
+    imported.clear();
+    BOOST_CHECK(!Codec::import_elements(buffer.data(), buffer.data() + buffer.size() - 1,
+                                        std::back_inserter(imported)));
+    BOOST_CHECK(!Codec::import_elements(buffer.data(), buffer.data() + sizeof(native::header) - 1,
+                                        std::back_inserter(imported)));
+    BOOST_CHECK(imported.empty());
+
+    // every header field is checked
+    for (std::size_t offset : {offsetof(native::header, magic), offsetof(native::header, version),
+                               offsetof(native::header, limb_size), offsetof(native::header, modulus_bits),
+                               offsetof(native::header, element_size), offsetof(native::header, modulus_fingerprint),
+                               offsetof(native::header, count)}) {
+        std::vector<std::uint8_t> corrupted = buffer;
+        corrupted[offset] ^= 0x01;
+        BOOST_CHECK(!Codec::import_elements(corrupted.data(), corrupted.data() + corrupted.size(),
+                                            std::back_inserter(imported)));
+    }
+    BOOST_CHECK(imported.empty());
+}
+
+template<typename FieldType>
+std::vector<typename FieldType::value_type> random_field_elements(std::size_t count) {
+    std::vector<typename FieldType::value_type> result;
+    for (std::size_t i = 0; i < count; ++i) {
+        result.push_back(random_element<FieldType>());
+    }
+    return result;
+}
+
+template<typename GroupType>
+std::vector<typename GroupType::value_type> random_group_elements(std::size_t count) {
+    std::vector<typename GroupType::value_type> result(1, GroupType::value_type::zero());
+    for (std::size_t i = 1; i < count; ++i) {
+        result.push_back(random_element<GroupType>());
+    }
+    return result;
+}
+
+template<typename Serializer>
+struct exposed_group_serializer : public Serializer {
+    using Serializer::curve_rhs;
+};
+
+// Big-endian encoding of the modulus, the smallest non-canonical coordinate
+template<typename Serializer>
+std::vector<std::uint8_t> modulus_octets() {
+    std::vector<std::uint8_t> result(Serializer::sizeof_base_element, 0);
+    nil::crypto3::multiprecision::export_bits(typename Serializer::integral_type(Serializer::base_field_type::modulus),
+                                              result.rbegin(), 8, false);
+    return result;
+}
+
+// Compressed encoding of x = k, with k the smallest positive integer for which x is off the curve
+template<typename Serializer>
+typename Serializer::compressed_octets off_curve_compressed() {
+    using field_value_type = typename Serializer::field_value_type;
+
+    field_value_type x = field_value_type::zero();
+    std::uint8_t k = 0;
+    do {
+        x = x + field_value_type::one();
+        ++k;
+    } while (exposed_group_serializer<Serializer>::curve_rhs(x).is_square());
+
+    typename Serializer::compressed_octets result = {0};
+    result[Serializer::sizeof_field_element - 1] = k;
+    result[0] |= Serializer::C_bit;
+    return result;
+}
+
+// A point on the curve of a group with a cofactor, outside the prime-order subgroup
+template<typename Serializer>
+typename Serializer::value_type curve_point_outside_subgroup() {
+    using value_type = typename Serializer::value_type;
+    using field_value_type = typename Serializer::field_value_type;
+
+    field_value_type x = field_value_type::one();
+    while (true) {
+        const field_value_type y2 = exposed_group_serializer<Serializer>::curve_rhs(x);
+        if (y2.is_square()) {
+            const value_type result(x, y2.sqrt(), field_value_type::one());
+            if (!curves::detail::subgroup_check_policy<typename value_type::params_type>::process(result)) {
+                return result;
+            }
+        }
+        x = x + field_value_type::one();
+    }
+}
+
+template<typename Serializer>
+void check_group_serializer() {
+    using value_type = typename Serializer::value_type;
+
+    constexpr std::size_t size = Serializer::sizeof_field_element;
+    const std::uint8_t C_bit = Serializer::C_bit, I_bit = Serializer::I_bit, S_bit = Serializer::S_bit;
+
+    std::vector<value_type> points(1, value_type::zero());
+    for (std::size_t i = 0; i < 8; ++i) {
+        points.push_back(random_element<typename Serializer::group_type>());
+    }
+
+    // round trips
+    for (const value_type &P : points) {
+        const auto compressed = Serializer::point_to_octets_compress(P);
+        const auto uncompressed = Serializer::point_to_octets(P);
+        BOOST_CHECK_EQUAL(compressed.size(), size);
+        BOOST_CHECK_EQUAL(uncompressed.size(), 2 * size);
+
+        std::pair<bool, value_type> decoded = Serializer::octets_to_point(compressed);
+        BOOST_CHECK(decoded.first);
+        BOOST_CHECK(decoded.second == P);
+        decoded = Serializer::octets_to_point(uncompressed);
+        BOOST_CHECK(decoded.first);
+        BOOST_CHECK(decoded.second == P);
+    }
+
+    // the point at infinity is the flag alone, or all zeros when there is no infinity flag
+    const auto zero_compressed = Serializer::point_to_octets_compress(value_type::zero());
+    const auto zero_uncompressed = Serializer::point_to_octets(value_type::zero());
+    BOOST_CHECK_EQUAL(zero_compressed[0], C_bit | I_bit);
+    BOOST_CHECK_EQUAL(zero_uncompressed[0], I_bit);
+    BOOST_CHECK(std::all_of(zero_compressed.begin() + 1, zero_compressed.end(), [](std::uint8_t c) { return c == 0; }));
+    BOOST_CHECK(
+        std::all_of(zero_uncompressed.begin() + 1, zero_uncompressed.end(), [](std::uint8_t c) { return c == 0; }));
+
+    const value_type P = points.back();
+    const auto P_compressed = Serializer::point_to_octets_compress(P);
+    const auto P_uncompressed = Serializer::point_to_octets(P);
+
+    // bad flags
+    if (C_bit) {
+        auto encoding = P_compressed;
+        encoding[0] &= ~C_bit;
+        BOOST_CHECK(!Serializer::octets_to_point(encoding).first);
+        auto uncompressed = P_uncompressed;
+        uncompressed[0] |= C_bit;
+        BOOST_CHECK(!Serializer::octets_to_point(uncompressed).first);
+    }
+    if (I_bit) {
+        auto encoding = P_compressed;
+        encoding[0] |= I_bit;
+        BOOST_CHECK(!Serializer::octets_to_point(encoding).first);
+        auto uncompressed = P_uncompressed;
+        uncompressed[0] |= I_bit;
+        BOOST_CHECK(!Serializer::octets_to_point(uncompressed).first);
+        auto zero = zero_compressed;
+        zero[0] |= S_bit;
+        BOOST_CHECK(!Serializer::octets_to_point(zero).first);
+    }
+    {
+        auto uncompressed = P_uncompressed;
+        uncompressed[0] |= S_bit;
+        BOOST_CHECK(!Serializer::octets_to_point(uncompressed).first);
+        std::vector<std::uint8_t> wrong_length(P_compressed.begin(), P_compressed.end() - 1);
+        BOOST_CHECK(!Serializer::octets_to_point(wrong_length).first);
+    }
+
+    // non-canonical coordinates: the highest coefficient of x, or of y, replaced by p
+    const std::vector<std::uint8_t> p = modulus_octets<Serializer>();
+    {
+        auto encoding = P_compressed;
+        const std::uint8_t flags = encoding[0] & Serializer::flags_mask;
+        std::copy(p.begin(), p.end(), encoding.begin());
+        encoding[0] |= flags;
+        BOOST_CHECK(!Serializer::octets_to_point(encoding).first);
+
+        auto uncompressed = P_uncompressed;
+        std::copy(p.begin(), p.end(), uncompressed.begin() + size);
+        BOOST_CHECK(!Serializer::octets_to_point(uncompressed).first);
+    }
+
+    // x off the curve, and y not matching x
+    {
+        typename Serializer::compressed_octets encoding = off_curve_compressed<Serializer>();
+        BOOST_CHECK(!Serializer::octets_to_point(encoding).first);
+        encoding[0] |= S_bit;
+        BOOST_CHECK(!Serializer::octets_to_point(encoding).first);
+
+        auto uncompressed = P_uncompressed;
+        uncompressed[2 * size - 1] ^= 0x01;
+        BOOST_CHECK(!Serializer::octets_to_point(uncompressed).first);
+    }
+
+    // batches, with one inversion for all the points
+    for (bool compress : {true, false}) {
+        const std::size_t encoding_size = compress ? size : 2 * size;
+        std::vector<std::uint8_t> octets(points.size() * encoding_size);
+        BOOST_CHECK(Serializer::points_to_octets(points.begin(), points.end(), octets.data(), compress) ==
+                    octets.data() + octets.size());
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            if (compress) {
+                const auto single = Serializer::point_to_octets_compress(points[i]);
+                BOOST_CHECK(std::equal(single.begin(), single.end(), octets.begin() + i * encoding_size));
+            } else {
+                const auto single = Serializer::point_to_octets(points[i]);
+                BOOST_CHECK(std::equal(single.begin(), single.end(), octets.begin() + i * encoding_size));
+            }
+        }
+
+        std::vector<value_type> decoded;
+        BOOST_CHECK(Serializer::octets_to_points(octets.data(), points.size(), std::back_inserter(decoded), compress));
+        BOOST_CHECK(decoded == points);
+
+        // an invalid entry comes back as the point at infinity and fails the batch
+        std::copy(p.begin(), p.end(), octets.begin() + 2 * encoding_size);
+        octets[2 * encoding_size] |= compress ? C_bit : 0;
+        decoded.clear();
+        BOOST_CHECK(
+            !Serializer::octets_to_points(octets.data(), points.size(), std::back_inserter(decoded), compress));
+        BOOST_CHECK_EQUAL(decoded.size(), points.size());
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            BOOST_CHECK(decoded[i] == (i == 2 ? value_type::zero() : points[i]));
+        }
+    }
+}
+
+template<typename CurveType>
+void check_pairing_curve_serializer() {
+    using serializer_type = curve_element_serializer<CurveType>;
+
+    check_group_serializer<typename serializer_type::g1_serializer>();
+    check_group_serializer<typename serializer_type::g2_serializer>();
+
+    const typename serializer_type::g1_value_type P = random_element<typename CurveType::template g1_type<>>();
+    const typename serializer_type::g2_value_type Q = random_element<typename CurveType::template g2_type<>>();
+    BOOST_CHECK(serializer_type::octets_to_g1_point(serializer_type::point_to_octets_compress(P)) == P);
+    BOOST_CHECK(serializer_type::octets_to_g1_point(serializer_type::point_to_octets(P)) == P);
+    BOOST_CHECK(serializer_type::octets_to_g2_point(serializer_type::point_to_octets_compress(Q)) == Q);
+    BOOST_CHECK(serializer_type::octets_to_g2_point(serializer_type::point_to_octets(Q)) == Q);
+
+    std::pair<bool, typename serializer_type::g1_value_type> p =
+        serializer_type::octets_to_checked_g1_point(serializer_type::point_to_octets_compress(P));
+    BOOST_CHECK(p.first);
+    BOOST_CHECK(p.second == P);
+    std::pair<bool, typename serializer_type::g2_value_type> q =
+        serializer_type::octets_to_checked_g2_point(serializer_type::point_to_octets(Q));
+    BOOST_CHECK(q.first);
+    BOOST_CHECK(q.second == Q);
+
+    BOOST_CHECK(!serializer_type::octets_to_checked_g1_point(
+                     off_curve_compressed<typename serializer_type::g1_serializer>())
+                     .first);
+    BOOST_CHECK(!serializer_type::octets_to_checked_g2_point(
+                     off_curve_compressed<typename serializer_type::g2_serializer>())
+                     .first);
+
+    // on the curve, so the encoding decodes, but outside the subgroup
+    const typename serializer_type::g2_value_type Q_bad =
+        curve_point_outside_subgroup<typename serializer_type::g2_serializer>();
+    BOOST_CHECK(serializer_type::g2_serializer::octets_to_point(serializer_type::point_to_octets(Q_bad)).first);
+    BOOST_CHECK(!serializer_type::octets_to_checked_g2_point(serializer_type::point_to_octets(Q_bad)).first);
+    BOOST_CHECK(!serializer_type::octets_to_checked_g2_point(serializer_type::point_to_octets_compress(Q_bad)).first);
+}
+
+template<typename CurveType>
+void check_cycle_curve_serializer() {
+    using serializer_type = curve_element_serializer<CurveType>;
+
+    check_group_serializer<typename serializer_type::g1_serializer>();
+
+    const typename serializer_type::g1_value_type P = random_element<typename CurveType::template g1_type<>>();
+    BOOST_CHECK(serializer_type::octets_to_g1_point(serializer_type::point_to_octets_compress(P)) == P);
+    BOOST_CHECK(serializer_type::octets_to_g1_point(serializer_type::point_to_octets(P)) == P);
+
+    std::pair<bool, typename serializer_type::g1_value_type> p =
+        serializer_type::octets_to_checked_g1_point(serializer_type::point_to_octets(P));
+    BOOST_CHECK(p.first);
+    BOOST_CHECK(p.second == P);
+    BOOST_CHECK(!serializer_type::octets_to_checked_g1_point(
+                     off_curve_compressed<typename serializer_type::g1_serializer>())
+                     .first);
+}
+
+BOOST_AUTO_TEST_SUITE(curve_element_serializer_test_suite)
+
+BOOST_AUTO_TEST_CASE(bls12_381_checked_deserialization_test) {
+    using serializer_type = curve_element_serializer<curves::bls12_381>;
+    using g1_value_type = serializer_type::g1_value_type;
+    using g2_value_type = serializer_type::g2_value_type;
+
+    const g1_value_type P = random_element<curves::bls12_381::g1_type<>>();
+    const g2_value_type Q = random_element<curves::bls12_381::g2_type<>>();
+
+    std::pair<bool, g1_value_type> p = serializer_type::octets_to_checked_g1_point(
+        serializer_type::point_to_octets_compress(P));
+    BOOST_CHECK(p.first);
+    BOOST_CHECK(p.second == P);
+    p = serializer_type::octets_to_checked_g1_point(serializer_type::point_to_octets(P));
+    BOOST_CHECK(p.first);
+    BOOST_CHECK(p.second == P);
+
+    std::pair<bool, g2_value_type> q = serializer_type::octets_to_checked_g2_point(
+        serializer_type::point_to_octets_compress(Q));
+    BOOST_CHECK(q.first);
+    BOOST_CHECK(q.second == Q);
+    q = serializer_type::octets_to_checked_g2_point(serializer_type::point_to_octets(Q));
+    BOOST_CHECK(q.first);
+    BOOST_CHECK(q.second == Q);
+
+    // on the curve, so the unchecked decoding accepts it, but outside the subgroup
+    const g1_value_type P_bad = point_outside_subgroup<g1_value_type>();
+    BOOST_CHECK(P_bad.is_well_formed());
+    BOOST_CHECK(serializer_type::octets_to_g1_point(serializer_type::point_to_octets_compress(P_bad)) == P_bad);
+    BOOST_CHECK(!serializer_type::octets_to_checked_g1_point(serializer_type::point_to_octets_compress(P_bad)).first);
+    BOOST_CHECK(!serializer_type::octets_to_checked_g1_point(serializer_type::point_to_octets(P_bad)).first);
+
+    const g2_value_type Q_bad = point_outside_subgroup<g2_value_type>();
+    BOOST_CHECK(Q_bad.is_well_formed());
+    BOOST_CHECK(serializer_type::octets_to_g2_point(serializer_type::point_to_octets_compress(Q_bad)) == Q_bad);
+    BOOST_CHECK(!serializer_type::octets_to_checked_g2_point(serializer_type::point_to_octets_compress(Q_bad)).first);
+    BOOST_CHECK(!serializer_type::octets_to_checked_g2_point(serializer_type::point_to_octets(Q_bad)).first);
+}
+
+BOOST_AUTO_TEST_CASE(bls12_381_bulk_decompression_test) {
+    using serializer_type = curve_element_serializer<curves::bls12_381>;
+    using g1_value_type = serializer_type::g1_value_type;
+    using g2_value_type = serializer_type::g2_value_type;
+    using g1_affine_value_type = serializer_type::g1_affine_value_type;
+    using g2_affine_value_type = serializer_type::g2_affine_value_type;
+
+    const std::size_t count = 30;
+
+    std::vector<std::uint8_t> g1_octets, g2_octets;
+    std::vector<g1_value_type> g1_expected;
+    std::vector<g2_value_type> g2_expected;
+    std::vector<bool> g1_valid, g2_valid;
+    make_compressed_batch<g1_value_type, serializer_type>(count, 1, g1_octets, g1_expected, g1_valid);
+    make_compressed_batch<g2_value_type, serializer_type>(count, 2, g2_octets, g2_expected, g2_valid);
+
+    for (std::size_t threads_number : {1, 4}) {
+        std::vector<g1_value_type> g1_out(count, g1_value_type::one());
+        std::vector<g1_affine_value_type> g1_affine_out(count, g1_affine_value_type::one());
+        BOOST_CHECK(!serializer_type::octets_to_g1_points(g1_octets.data(), count, g1_out.data(), false,
+                                                          threads_number));
+        BOOST_CHECK(!serializer_type::octets_to_g1_points(g1_octets.data(), count, g1_affine_out.data(), false,
+                                                          threads_number));
+
+        std::vector<g2_value_type> g2_out(count, g2_value_type::one());
+        std::vector<g2_affine_value_type> g2_affine_out(count, g2_affine_value_type::one());
+        BOOST_CHECK(!serializer_type::octets_to_g2_points(g2_octets.data(), count, g2_out.data(), false,
+                                                          threads_number));
+        BOOST_CHECK(!serializer_type::octets_to_g2_points(g2_octets.data(), count, g2_affine_out.data(), false,
+                                                          threads_number));
+
+        for (std::size_t i = 0; i < count; ++i) {
+            BOOST_CHECK(g1_out[i] == g1_expected[i]);
+            BOOST_CHECK(g1_affine_out[i] == g1_expected[i].to_affine());
+            BOOST_CHECK(g2_out[i] == g2_expected[i]);
+            BOOST_CHECK(g2_affine_out[i] == g2_expected[i].to_affine());
+        }
+    }
+
+    // the valid entries alone decode without error, with and without the subgroup check
+    std::vector<std::uint8_t> g1_valid_octets;
+    std::vector<g1_value_type> g1_valid_expected;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (g1_valid[i]) {
+            g1_valid_octets.insert(g1_valid_octets.end(), g1_octets.begin() + i * serializer_type::sizeof_field_element,
+                                   g1_octets.begin() + (i + 1) * serializer_type::sizeof_field_element);
+            g1_valid_expected.push_back(g1_expected[i]);
+        }
+    }
+    std::vector<g1_value_type> g1_valid_out(g1_valid_expected.size());
+    BOOST_CHECK(serializer_type::octets_to_g1_points(g1_valid_octets.data(), g1_valid_out.size(),
+                                                     g1_valid_out.data(), true, 3));
+    BOOST_CHECK(g1_valid_out == g1_valid_expected);
+
+    // a point on the curve outside the subgroup is rejected only when the subgroup is checked
+    const g1_value_type P_bad = point_outside_subgroup<g1_value_type>();
+    const g2_value_type Q_bad = point_outside_subgroup<g2_value_type>();
+    const auto P_bad_octets = serializer_type::point_to_octets_compress(P_bad);
+    const auto Q_bad_octets = serializer_type::point_to_octets_compress(Q_bad);
+
+    g1_value_type P_out;
+    g2_value_type Q_out;
+    BOOST_CHECK(serializer_type::octets_to_g1_points(P_bad_octets.data(), 1, &P_out, false));
+    BOOST_CHECK(P_out == P_bad);
+    BOOST_CHECK(!serializer_type::octets_to_g1_points(P_bad_octets.data(), 1, &P_out, true));
+    BOOST_CHECK(P_out.is_zero());
+
+    BOOST_CHECK(serializer_type::octets_to_g2_points(Q_bad_octets.data(), 1, &Q_out, false));
+    BOOST_CHECK(Q_out == Q_bad);
+    BOOST_CHECK(!serializer_type::octets_to_g2_points(Q_bad_octets.data(), 1, &Q_out, true));
+    BOOST_CHECK(Q_out.is_zero());
+}
+
+BOOST_AUTO_TEST_CASE(bls12_377_serializer_test) {
+    check_pairing_curve_serializer<curves::bls12_377>();
+}
+
+BOOST_AUTO_TEST_CASE(alt_bn128_254_serializer_test) {
+    check_pairing_curve_serializer<curves::alt_bn128_254>();
+}
+
+BOOST_AUTO_TEST_CASE(mnt4_298_serializer_test) {
+    check_pairing_curve_serializer<curves::mnt4_298>();
+}
+
+BOOST_AUTO_TEST_CASE(mnt6_298_serializer_test) {
+    check_pairing_curve_serializer<curves::mnt6_298>();
+}
+
+BOOST_AUTO_TEST_CASE(pallas_serializer_test) {
+    check_cycle_curve_serializer<curves::pallas>();
+}
+
+BOOST_AUTO_TEST_CASE(vesta_serializer_test) {
+    check_cycle_curve_serializer<curves::vesta>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(native_marshalling_test_suite)
+
+BOOST_AUTO_TEST_CASE(native_field_round_trip_test) {
+    using curve_type = curves::bls12_381;
+
+    check_native_round_trip<native::field<curve_type::base_field_type>>(
+        random_field_elements<curve_type::base_field_type>(5));
+    check_native_round_trip<native::field<curve_type::scalar_field_type>>(
+        random_field_elements<curve_type::scalar_field_type>(5));
+    check_native_round_trip<native::field<curve_type::g2_type<>::field_type>>(
+        random_field_elements<curve_type::g2_type<>::field_type>(5));
+    check_native_round_trip<native::field<curve_type::gt_type>>(random_field_elements<curve_type::gt_type>(3));
+}
+
+BOOST_AUTO_TEST_CASE(native_curve_element_round_trip_test) {
+    using curve_type = curves::bls12_381;
+
+    check_native_round_trip<native::curve_element<curve_type::g1_type<>>>(
+        random_group_elements<curve_type::g1_type<>>(5));
+    check_native_round_trip<native::curve_element<curve_type::g2_type<>>>(
+        random_group_elements<curve_type::g2_type<>>(5));
+
+    std::vector<curve_type::g1_type<curves::coordinates::affine>::value_type> affine;
+    for (const auto &P : random_group_elements<curve_type::g1_type<>>(5)) {
+        affine.push_back(P.to_affine());
+    }
+    check_native_round_trip<native::curve_element<curve_type::g1_type<curves::coordinates::affine>>>(affine);
+}
+
+BOOST_AUTO_TEST_CASE(native_modulus_mismatch_test) {
+    // the MNT4 and MNT6 base fields have the same size and limb layout, only the modulus tells them apart
+    using mnt4_codec = native::field<curves::mnt4<298>::base_field_type>;
+    using mnt6_codec = native::field<curves::mnt6<298>::base_field_type>;
+    BOOST_CHECK_EQUAL(mnt4_codec::modulus_bits, mnt6_codec::modulus_bits);
+    BOOST_CHECK_EQUAL(mnt4_codec::element_size, mnt6_codec::element_size);
+    BOOST_CHECK_NE(mnt4_codec::modulus_fingerprint(), mnt6_codec::modulus_fingerprint());
+
+    const std::vector<mnt4_codec::value_type> elements = random_field_elements<curves::mnt4<298>::base_field_type>(4);
+    std::vector<std::uint8_t> buffer(mnt4_codec::buffer_size(elements.size()));
+    mnt4_codec::export_elements(elements.begin(), elements.end(), buffer.data());
+
+    std::vector<mnt6_codec::value_type> imported;
+    BOOST_CHECK(!mnt6_codec::import_elements(buffer.data(), buffer.data() + buffer.size(),
+                                             std::back_inserter(imported)));
+    BOOST_CHECK(imported.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -36,9 +36,13 @@
 
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/fixed_base.hpp>
+#include <nil/crypto3/algebra/multiexp/double_scalar_mul.hpp>
 
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/jubjub.hpp>
 //#include <nil/crypto3/algebra/curves/bn128.hpp>
 // #include <nil/crypto3/algebra/curves/brainpool_r1.hpp>
 #include <nil/crypto3/algebra/curves/edwards.hpp>
@@ -46,6 +50,8 @@
 // #include <nil/crypto3/algebra/curves/gost_A.hpp>
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
 // #include <nil/crypto3/algebra/curves/p192.hpp>
 // #include <nil/crypto3/algebra/curves/p224.hpp>
 // #include <nil/crypto3/algebra/curves/p256.hpp>
@@ -73,6 +79,12 @@
 // #include <nil/crypto3/algebra/curves/params/multiexp/sm2p_v1.hpp>
 // #include <nil/crypto3/algebra/curves/params/multiexp/x962_p.hpp>
 
+#include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
+
+#include <nil/crypto3/algebra/curves/params/fixed_base/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/fixed_base/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/params/fixed_base/jubjub.hpp>
+
 #include <nil/crypto3/algebra/random_element.hpp>
 
 using namespace nil::crypto3::algebra;
@@ -84,15 +96,14 @@ template<typename T>
 using test_instances_t = std::vector<std::vector<T>>;
 
 template<typename GroupType>
-test_instances_t<GroupType> generate_group_elements(std::size_t count, std::size_t size) {
+test_instances_t<typename GroupType::value_type> generate_group_elements(std::size_t count, std::size_t size) {
     // generating a random group element is expensive,
     // so for now we only generate a single one and repeat it
-    test_instances_t<GroupType> result(count);
+    test_instances_t<typename GroupType::value_type> result(count);
 
     for (size_t i = 0; i < count; i++) {
 
-        typename GroupType::value_type x =
-            random_element<GroupType>().to_projective();    // djb requires input to be in special form
+        typename GroupType::value_type x = random_element<GroupType>();
 
         for (size_t j = 0; j < size; j++) {
             result[i].push_back(x);
@@ -104,14 +115,12 @@ test_instances_t<GroupType> generate_group_elements(std::size_t count, std::size
 }
 
 template<typename FieldType>
-test_instances_t<FieldType> generate_scalars(std::size_t count, std::size_t size) {
-    // we use SHA512_rng because it is much faster than
-    // FieldType::random_element()
-    test_instances_t<FieldType> result(count);
+test_instances_t<typename FieldType::value_type> generate_scalars(std::size_t count, std::size_t size) {
+    test_instances_t<typename FieldType::value_type> result(count);
 
     for (size_t i = 0; i < count; i++) {
         for (size_t j = 0; j < size; j++) {
-            result[i].push_back(random_element<FieldType>(i * size + j));
+            result[i].push_back(random_element<FieldType>());
         }
     }
 
@@ -125,7 +134,8 @@ long long get_nsec_time() {
 
 template<typename GroupType, typename FieldType, typename MultiexpMethod>
 run_result_t<GroupType>
-    profile_multiexp(test_instances_t<GroupType> group_elements, test_instances_t<FieldType> scalars) {
+    profile_multiexp(test_instances_t<typename GroupType::value_type> group_elements,
+                     test_instances_t<typename FieldType::value_type> scalars) {
     long long start_time = get_nsec_time();
 
     std::vector<typename GroupType::value_type> answers;
@@ -146,8 +156,9 @@ void print_performance_csv(size_t expn_start, std::size_t expn_end_fast, std::si
         printf("%ld", expn);
         fflush(stdout);
 
-        test_instances_t<GroupType> group_elements = generate_group_elements<GroupType>(10, 1 << expn);
-        test_instances_t<FieldType> scalars = generate_scalars<FieldType>(10, 1 << expn);
+        test_instances_t<typename GroupType::value_type> group_elements =
+            generate_group_elements<GroupType>(10, 1 << expn);
+        test_instances_t<typename FieldType::value_type> scalars = generate_scalars<FieldType>(10, 1 << expn);
 
         run_result_t<GroupType> result_bos_coster =
             profile_multiexp<GroupType, FieldType, policies::multiexp_method_bos_coster>(group_elements, scalars);
@@ -178,8 +189,127 @@ void print_performance_csv(size_t expn_start, std::size_t expn_end_fast, std::si
     }
 }
 
+template<typename GroupType, typename FieldType>
+void check_fixed_base_mul() {
+    using group_value_type = typename GroupType::value_type;
+    using scalar_value_type = typename FieldType::value_type;
+
+    BOOST_CHECK(fixed_base_mul<GroupType>(scalar_value_type::zero()) == group_value_type::zero());
+    BOOST_CHECK(fixed_base_mul<GroupType>(scalar_value_type::one()) == group_value_type::one());
+    BOOST_CHECK(fixed_base_mul<GroupType>(-scalar_value_type::one()) == -group_value_type::one());
+
+    for (std::size_t i = 0; i < 16; i++) {
+        scalar_value_type s = random_element<FieldType>();
+        BOOST_CHECK(fixed_base_mul<GroupType>(s) == group_value_type::one() * s);
+    }
+
+    // a table for an arbitrary point and window
+    group_value_type P = group_value_type::one().doubled();
+    fixed_base_table<GroupType> table(P, FieldType::modulus_bits, 3);
+    scalar_value_type s = random_element<FieldType>();
+    BOOST_CHECK(table.mul(s) == P * s);
+}
+
+template<typename GroupType, typename FieldType>
+void check_multiexp_cached_bases() {
+    std::vector<typename GroupType::value_type> group_elements;
+    std::vector<typename FieldType::value_type> scalars;
+    for (std::size_t i = 0; i < 64; i++) {
+        group_elements.push_back(random_element<GroupType>());
+        scalars.push_back(random_element<FieldType>());
+    }
+
+    typename GroupType::value_type expected = multiexp<policies::multiexp_method_naive_plain>(
+        group_elements.cbegin(), group_elements.cend(), scalars.cbegin(), scalars.cend(), 1);
+    BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(group_elements.cbegin(), group_elements.cend(),
+                                                           scalars.cbegin(), scalars.cend(), 1) == expected);
+}
+
+template<typename GroupType>
+void check_double_scalar_mul() {
+    using group_value_type = typename GroupType::value_type;
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+
+    const group_value_type G = group_value_type::one();
+
+    BOOST_CHECK(double_scalar_mul<GroupType>(scalar_value_type::zero(), G, scalar_value_type::zero()).is_zero());
+    BOOST_CHECK(double_scalar_mul<GroupType>(-scalar_value_type::one(), G, scalar_value_type::one()).is_zero());
+
+    std::vector<scalar_value_type> u1, u2;
+    std::vector<group_value_type> Q, R;
+    for (std::size_t i = 0; i < 16; i++) {
+        u1.push_back(random_element<scalar_field_type>());
+        u2.push_back(random_element<scalar_field_type>());
+        Q.push_back(G * random_element<scalar_field_type>());
+        R.push_back(G * u1[i] + Q[i] * u2[i]);
+
+        BOOST_CHECK(double_scalar_mul<GroupType>(u1[i], Q[i], u2[i]) == R[i]);
+        BOOST_CHECK(double_scalar_mul<GroupType>(u1[i] + scalar_value_type::one(), Q[i], u2[i]) != R[i]);
+    }
+
+    BOOST_CHECK(batch_double_scalar_mul_check<GroupType>(u1.cbegin(), u1.cend(), Q.cbegin(), u2.cbegin(), R.cbegin()));
+    R[3] = R[3] + G;
+    BOOST_CHECK(!batch_double_scalar_mul_check<GroupType>(u1.cbegin(), u1.cend(), Q.cbegin(), u2.cbegin(), R.cbegin()));
+}
+
+template<typename GroupType>
+void check_glv_decomposition() {
+    using group_value_type = typename GroupType::value_type;
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using endomorphism_type = curves::detail::glv_endomorphism_policy<typename GroupType::params_type>;
+    using nil::crypto3::multiprecision::cpp_int;
+
+    BOOST_CHECK(endomorphism_type::value);
+
+    const group_value_type G = group_value_type::one();
+    BOOST_CHECK(endomorphism_type::phi(G) == G * typename scalar_field_type::value_type(endomorphism_type::lambda));
+
+    const cpp_int r(scalar_field_type::modulus);
+    const cpp_int lambda(endomorphism_type::lambda);
+    const cpp_int bound = cpp_int(1) << 128;
+
+    std::vector<cpp_int> scalars = {0, 1, r - 1, lambda, r / 2};
+    for (std::size_t i = 0; i < 256; i++) {
+        scalars.push_back(
+            random_element<scalar_field_type>().data.template convert_to<typename scalar_field_type::integral_type>());
+    }
+
+    for (const cpp_int &k : scalars) {
+        const std::array<cpp_int, 2> k12 = endomorphism_type::decompose(k);
+
+        BOOST_CHECK_EQUAL((k12[0] + k12[1] * lambda - k) % r, 0);
+        // |k1|, |k2| < 2^128, as decompose promises
+        BOOST_CHECK_LT(abs(k12[0]), bound);
+        BOOST_CHECK_LT(abs(k12[1]), bound);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(multiexp_test_suite)
 
+BOOST_AUTO_TEST_CASE(fixed_base_test_case) {
+    check_fixed_base_mul<curves::curve25519::g1_type<>, curves::curve25519::scalar_field_type>();
+    check_fixed_base_mul<curves::jubjub::g1_type<>, curves::jubjub::scalar_field_type>();
+    check_fixed_base_mul<curves::bls12<381>::g1_type<>, curves::bls12<381>::scalar_field_type>();
+    check_fixed_base_mul<curves::bls12<381>::g2_type<>, curves::bls12<381>::scalar_field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(multiexp_cached_bases_test_case) {
+    check_multiexp_cached_bases<curves::curve25519::g1_type<>, curves::curve25519::scalar_field_type>();
+    check_multiexp_cached_bases<curves::jubjub::g1_type<>, curves::jubjub::scalar_field_type>();
+}
+
+BOOST_AUTO_TEST_CASE(double_scalar_mul_test_case) {
+    check_double_scalar_mul<curves::secp_k1<256>::g1_type<>>();
+    check_double_scalar_mul<curves::secp_k1<256>::g1_type<curves::coordinates::projective_with_a4_0>>();
+    check_double_scalar_mul<curves::secp_r1<256>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(glv_decomposition_test_case) {
+    check_glv_decomposition<curves::secp_k1<256>::g1_type<>>();
+    check_glv_decomposition<curves::secp_k1<256>::g1_type<curves::coordinates::projective_with_a4_0>>();
+}
+
 BOOST_AUTO_TEST_CASE(multiexp_test_case) {
 
     std::cout << "Testing BLS12-381 G1" << std::endl;
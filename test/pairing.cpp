@@ -39,15 +39,19 @@
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
 
+#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
 #include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/pairing/detail/bls12/377/params.hpp>
 #include <nil/crypto3/algebra/pairing/mnt4.hpp>
 #include <nil/crypto3/algebra/pairing/mnt6.hpp>
 
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp4.hpp>
@@ -921,4 +925,75 @@ BOOST_DATA_TEST_CASE(pairing_operation_test_mnt6_298, string_data("pairing_opera
 
     pairing_operation_test<curve_type>(data_set);
 }
+
+BOOST_AUTO_TEST_CASE(gt_exp_test_bls12_381) {
+    using curve_type = typename curves::bls12<381>;
+    using scalar_integral_type = typename curve_type::scalar_field_type::integral_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+
+    const gt_value_type e = pair_reduced<curve_type>(curve_type::template g1_type<>::value_type::one(),
+                                                     curve_type::template g2_type<>::value_type::one());
+
+    const scalar_integral_type exponents[] = {
+        scalar_integral_type(0), scalar_integral_type(1), scalar_integral_type(0xd201000000010000),
+        curve_type::scalar_field_type::modulus - 1,
+        scalar_integral_type("0x4a5c01f0e9e6eeb5e8b3a3f5c0e54d2f2b3b1a8d7c6e5f4a3b2c1d0e0f1a2b3c")};
+
+    for (const scalar_integral_type &exponent : exponents) {
+        BOOST_CHECK_EQUAL(gt_exp<curve_type>(e, exponent), e.pow(exponent));
+    }
+}
+
+// GT element of order r without a pairing: the easy part (p^6 - 1)(p^2 + 1) of the final exponentiation maps
+// into the cyclotomic subgroup, the hard part (p^4 - p^2 + 1) / r then into its order-r subgroup
+template<typename CurveType>
+typename CurveType::gt_type::value_type random_gt_element() {
+    using gt_value_type = typename CurveType::gt_type::value_type;
+
+    const cpp_int p(CurveType::base_field_type::modulus);
+    const cpp_int r(CurveType::scalar_field_type::modulus);
+    const cpp_int hard_part = (p * p * p * p - p * p + 1) / r;
+
+    const gt_value_type f = random_element<typename CurveType::gt_type>();
+    gt_value_type e = f.unitary_inversed() * f.inversed();
+    e = e.Frobenius_map(2) * e;
+
+    return e.pow(hard_part);
+}
+
+template<typename CurveType, typename GtExp>
+void gt_exp_test() {
+    using scalar_field_type = typename CurveType::scalar_field_type;
+    using scalar_integral_type = typename scalar_field_type::integral_type;
+    using gt_value_type = typename CurveType::gt_type::value_type;
+
+    const gt_value_type e = random_gt_element<CurveType>();
+    BOOST_CHECK(e != gt_value_type::one());
+    BOOST_CHECK(e.pow(scalar_field_type::modulus) == gt_value_type::one());
+
+    std::vector<scalar_integral_type> exponents;
+    exponents.push_back(scalar_integral_type(0));
+    exponents.push_back(scalar_integral_type(1));
+    exponents.push_back(scalar_integral_type(pairing::detail::pairing_params<CurveType>::gt_exp_frobenius_eigenvalue));
+    exponents.push_back(scalar_integral_type(scalar_field_type::modulus - 1));
+    for (std::size_t i = 0; i < 4; i++) {
+        exponents.push_back(random_element<scalar_field_type>().data.template convert_to<scalar_integral_type>());
+    }
+
+    for (const scalar_integral_type &exponent : exponents) {
+        BOOST_CHECK(GtExp::process(e, exponent) == e.pow(exponent));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(gt_exp_test_bls12_377) {
+    using curve_type = typename curves::bls12<377>;
+
+    gt_exp_test<curve_type, short_weierstrass_jacobian_with_a4_0_gt_exp<curve_type>>();
+}
+
+BOOST_AUTO_TEST_CASE(gt_exp_test_alt_bn128_254) {
+    using curve_type = typename curves::alt_bn128<254>;
+
+    gt_exp_test<curve_type, typename pairing_policy<curve_type>::gt_exp>();
+}
 BOOST_AUTO_TEST_SUITE_END()
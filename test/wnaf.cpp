@@ -37,8 +37,37 @@
 
 #include <nil/crypto3/algebra/wnaf.hpp>
 
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/jubjub.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
 using namespace nil::crypto3::algebra;
 
+template<typename GroupType>
+void check_cached_wnaf() {
+    using group_value_type = typename GroupType::value_type;
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using integral_type = typename scalar_field_type::integral_type;
+
+    group_value_type P = random_element<GroupType>(), Q = random_element<GroupType>();
+
+    BOOST_CHECK(P + Q.to_cached() == P + Q);
+    BOOST_CHECK(P - Q.to_cached() == P - Q);
+    BOOST_CHECK(P + P.to_cached() == P.doubled());
+    BOOST_CHECK(P - P.to_cached() == group_value_type::zero());
+
+    integral_type k = random_element<scalar_field_type>().data.template convert_to<integral_type>();
+    for (std::size_t window = 2; window <= 6; window++) {
+        BOOST_CHECK(fixed_window_wnaf_exp(window, P, k) == P * k);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(wnaf_test_suite)
 
+BOOST_AUTO_TEST_CASE(wnaf_cached_test) {
+    check_cached_wnaf<curves::curve25519::g1_type<>>();
+    check_cached_wnaf<curves::jubjub::g1_type<>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()